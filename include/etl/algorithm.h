@@ -2,12 +2,39 @@
 #define ETL_ALGORITHM_H
 
 #include "etl/utility.h"
+#include <cstring> // memmove, memset, memchr
+
+namespace Project::etl::detail {
+    /// pointer to a non-volatile integral type, the accesses through volatile pointers have to stay element by element
+    template <typename Iterator, typename E = etl::remove_pointer_t<Iterator>>
+    inline constexpr bool is_integral_pointer_v = etl::is_pointer_v<Iterator> && etl::is_integral_v<E> && !etl::is_volatile_v<E>;
+
+    /// pointer to a non-volatile integral type of one byte, except bool
+    template <typename Iterator, typename E = etl::remove_pointer_t<Iterator>>
+    inline constexpr bool is_byte_pointer_v = is_integral_pointer_v<Iterator> && sizeof(E) == 1 &&
+        !etl::is_same_v<etl::remove_const_t<E>, bool>;
+
+    /// both iterators are pointers to the same trivially copyable type, neither is volatile and the destination is not const
+    template <typename Iterator, typename IteratorDest, typename E = etl::remove_pointer_t<IteratorDest>>
+    inline constexpr bool is_memmove_copyable_v = etl::is_pointer_v<Iterator> && etl::is_pointer_v<IteratorDest> &&
+        etl::is_same_v<etl::remove_const_t<etl::remove_pointer_t<Iterator>>, E> && etl::is_same_v<etl::remove_const_volatile_t<E>, E> &&
+        etl::is_trivially_copyable_v<E>;
+}
 
 namespace Project::etl {
 
     /// find the first element that is equal to the given value
+    /// @note a contiguous range of bytes is searched with memchr
     template <typename Iterator, typename T> constexpr auto
     find(Iterator first, Iterator last, T&& value) {
+        if constexpr (detail::is_byte_pointer_v<Iterator> && etl::is_integral_v<etl::decay_t<T>>) {
+            if (!etl::is_constant_evaluated()) {
+                typedef etl::remove_const_t<etl::remove_pointer_t<Iterator>> E;
+                if (!(first < last) || (long long)(E(value)) != (long long)(value)) return last; // value out of range of E
+                auto p = ::memchr(first, static_cast<unsigned char>(value), last - first);
+                return p ? first + (static_cast<const char*>(p) - reinterpret_cast<const char*>(first)) : last;
+            }
+        }
         for (; first != last; ++first) if (*first == value) 
             return first;
         return last;
@@ -172,12 +199,24 @@ namespace Project::etl {
     }
     
     /// assign the given value to each element
+    /// @note a contiguous range of bytes, or of integers assigned to zero, is filled with memset
     template <typename Iterator, typename T> constexpr void
-    fill(Iterator first, Iterator last, T&& value) { for (; first != last; ++first) *first = etl::forward<T>(value); }
+    fill(Iterator first, Iterator last, T&& value) {
+        if constexpr (detail::is_integral_pointer_v<Iterator> && etl::is_integral_v<etl::decay_t<T>>) {
+            if (!etl::is_constant_evaluated() && (detail::is_byte_pointer_v<Iterator> || value == 0)) {
+                if (first < last) ::memset(first, static_cast<unsigned char>(value), (last - first) * sizeof(*first));
+                return;
+            }
+        }
+        for (; first != last; ++first) *first = etl::forward<T>(value);
+    }
 
     /// assign the given value to each element
     template <typename Sequence, typename T> constexpr void
-    fill(Sequence&& seq, T&& value) { for (auto& x : seq) x = etl::forward<T>(value); }
+    fill(Sequence&& seq, T&& value) {
+        if constexpr (etl::is_pointer_v<decltype(etl::begin(seq))>) etl::fill(etl::begin(seq), etl::end(seq), etl::forward<T>(value));
+        else for (auto& x : seq) x = etl::forward<T>(value);
+    }
     
     /// assign the results of successive call of the generator to each element
     template <typename Iterator, typename Generator> constexpr void
@@ -214,15 +253,32 @@ namespace Project::etl {
     }
 
     /// copy all of elements to the given destination
+    /// @note trivially copyable elements of contiguous ranges are copied with memmove
     template <typename Iterator, typename IteratorDest> constexpr auto
     copy(Iterator first, Iterator last, IteratorDest dest) {
+        if constexpr (detail::is_memmove_copyable_v<Iterator, IteratorDest>) {
+            if (!etl::is_constant_evaluated()) {
+                if (dest == nullptr || !(first < last)) return dest;
+                ::memmove(dest, first, (last - first) * sizeof(*first));
+                return dest + (last - first);
+            }
+        }
         for (; first != last && dest != nullptr; ++first, ++dest) *dest = *first;
         return dest;
     }
 
     /// copy all of elements to the given destination
+    /// @note trivially copyable elements of contiguous ranges are copied with memmove
     template <typename Iterator, typename IteratorDest> constexpr auto
     copy(Iterator first, Iterator last, IteratorDest dest, IteratorDest dest_last) {
+        if constexpr (detail::is_memmove_copyable_v<Iterator, IteratorDest>) {
+            if (!etl::is_constant_evaluated()) {
+                const auto n = last - first < dest_last - dest ? last - first : dest_last - dest;
+                if (n <= 0) return dest;
+                ::memmove(dest, first, n * sizeof(*first));
+                return dest + n;
+            }
+        }
         for (; first != last && dest != dest_last; ++first, ++dest) *dest = *first;
         return dest;
     }
@@ -395,6 +451,164 @@ namespace Project::etl {
     template <typename Sequence> constexpr auto
     sum_element(Sequence&& seq) { return etl::sum_element(etl::begin(seq), etl::end(seq)); }
 
+    /// less-than comparison function object
+    struct Less {
+        template <typename T, typename U> constexpr bool operator()(const T& a, const U& b) const { return a < b; }
+    };
+
+    /// greater-than comparison function object
+    struct Greater {
+        template <typename T, typename U> constexpr bool operator()(const T& a, const U& b) const { return b < a; }
+    };
+
+    /// find the first element of a sorted range that is not less than the given value.
+    /// the loop is branchless, the compiler emits a conditional move instead of a jump
+    template <typename Iterator, typename T, typename Compare = etl::Less> constexpr Iterator
+    lower_bound(Iterator first, Iterator last, const T& value, Compare&& comp = {}) {
+        size_t n = last - first;
+        if (n == 0) return first;
+        while (n > 1) {
+            const size_t half = n / 2;
+            first = comp(first[half], value) ? first + half : first;
+            n -= half;
+        }
+        return first + comp(*first, value);
+    }
+
+    /// find the first element of a sorted sequence that is not less than the given value
+    template <typename Sequence, typename T> constexpr auto
+    lower_bound(Sequence&& seq, const T& value) { return etl::lower_bound(etl::begin(seq), etl::end(seq), value); }
+
+    /// find the first element of a sorted range that is greater than the given value
+    template <typename Iterator, typename T, typename Compare = etl::Less> constexpr Iterator
+    upper_bound(Iterator first, Iterator last, const T& value, Compare&& comp = {}) {
+        size_t n = last - first;
+        if (n == 0) return first;
+        while (n > 1) {
+            const size_t half = n / 2;
+            first = comp(value, first[half]) ? first : first + half;
+            n -= half;
+        }
+        return first + !comp(value, *first);
+    }
+
+    /// find the first element of a sorted sequence that is greater than the given value
+    template <typename Sequence, typename T> constexpr auto
+    upper_bound(Sequence&& seq, const T& value) { return etl::upper_bound(etl::begin(seq), etl::end(seq), value); }
+
+    /// check if a sorted range contains the given value
+    template <typename Iterator, typename T, typename Compare = etl::Less> constexpr bool
+    binary_search(Iterator first, Iterator last, const T& value, Compare&& comp = {}) {
+        first = etl::lower_bound(first, last, value, comp);
+        return first != last && !comp(value, *first);
+    }
+
+    /// check if a sorted sequence contains the given value
+    template <typename Sequence, typename T> constexpr bool
+    binary_search(Sequence&& seq, const T& value) { return etl::binary_search(etl::begin(seq), etl::end(seq), value); }
+
+    /// remove consecutive equal elements, return the new end of the range
+    template <typename Iterator, typename BinaryPredicate> constexpr Iterator
+    unique(Iterator first, Iterator last, BinaryPredicate&& fn) {
+        if (first == last) return last;
+        auto dest = first;
+        for (++first; first != last; ++first) {
+            if (fn(*dest, *first)) continue;
+            ++dest;
+            if (dest != first) *dest = etl::move(*first);
+        }
+        return ++dest;
+    }
+
+    /// remove consecutive equal elements, return the new end of the range
+    template <typename Iterator> constexpr Iterator
+    unique(Iterator first, Iterator last) { return etl::unique(first, last, [](const auto& a, const auto& b) { return a == b; }); }
+}
+
+namespace Project::etl::detail {
+    template <typename Iterator, typename Compare> constexpr void
+    insertion_sort(Iterator first, Iterator last, Compare& comp) {
+        if (first == last) return;
+        for (auto i = first + 1; i != last; ++i) {
+            auto value = etl::move(*i);
+            auto j = i;
+            for (; j != first && comp(value, *(j - 1)); --j) *j = etl::move(*(j - 1));
+            *j = etl::move(value);
+        }
+    }
+
+    template <typename Iterator, typename Compare> constexpr void
+    sift_down(Iterator first, size_t root, size_t n, Compare& comp) {
+        for (size_t child = 2 * root + 1; child < n; child = 2 * root + 1) {
+            if (child + 1 < n && comp(first[child], first[child + 1])) ++child;
+            if (!comp(first[root], first[child])) return;
+            etl::swap(first[root], first[child]);
+            root = child;
+        }
+    }
+
+    template <typename Iterator, typename Compare> constexpr void
+    heap_sort(Iterator first, Iterator last, Compare& comp) {
+        const size_t n = last - first;
+        for (size_t i = n / 2; i-- > 0;) sift_down(first, i, n, comp);
+        for (size_t end = n; end-- > 1;) {
+            etl::swap(first[0], first[end]);
+            sift_down(first, 0, end, comp);
+        }
+    }
+
+    template <typename Iterator, typename Compare> constexpr void
+    move_median_to_first(Iterator result, Iterator a, Iterator b, Iterator c, Compare& comp) {
+        if (comp(*a, *b)) {
+            if (comp(*b, *c)) etl::swap(*result, *b);
+            else if (comp(*a, *c)) etl::swap(*result, *c);
+            else etl::swap(*result, *a);
+        }
+        else if (comp(*a, *c)) etl::swap(*result, *a);
+        else if (comp(*b, *c)) etl::swap(*result, *c);
+        else etl::swap(*result, *b);
+    }
+
+    template <typename Iterator, typename Compare> constexpr Iterator
+    unguarded_partition(Iterator first, Iterator last, Iterator pivot, Compare& comp) {
+        while (true) {
+            while (comp(*first, *pivot)) ++first;
+            --last;
+            while (comp(*pivot, *last)) --last;
+            if (!(first < last)) return first;
+            etl::swap(*first, *last);
+            ++first;
+        }
+    }
+
+    template <typename Iterator, typename Compare> constexpr void
+    introsort_loop(Iterator first, Iterator last, size_t depth, Compare& comp) {
+        while (last - first > 16) {
+            if (depth == 0) return heap_sort(first, last, comp);
+            --depth;
+            move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+            auto cut = unguarded_partition(first + 1, last, first, comp);
+            introsort_loop(cut, last, depth, comp);
+            last = cut;
+        }
+    }
+}
+
+namespace Project::etl {
+    /// sort the elements of a random access range, the order of equal elements is not preserved.
+    /// quicksort that falls back to heapsort if the recursion is too deep, small partitions are insertion sorted
+    template <typename Iterator, typename Compare = etl::Less> constexpr void
+    sort(Iterator first, Iterator last, Compare&& comp = {}) {
+        size_t depth = 0;
+        for (size_t n = last - first; n > 1; n >>= 1) depth += 2;
+        detail::introsort_loop(first, last, depth, comp);
+        detail::insertion_sort(first, last, comp);
+    }
+
+    /// sort the elements of a contiguous sequence
+    template <typename Sequence> constexpr void
+    sort(Sequence&& seq) { etl::sort(etl::begin(seq), etl::end(seq)); }
+
     /// clamps a value between a pair of boundary values
     template <typename T, typename U, typename V> constexpr auto
     clamp(T&& x, U&& lo, V&& hi) {
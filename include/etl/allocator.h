@@ -14,7 +14,22 @@ namespace Project::etl {
         
         T* allocate(size_t n) { return (T*) ::malloc(n * sizeof(T)); }
         void deallocate(T* p, size_t) { ::free((void*)p); }
+
+        /// resize an allocation, the content is moved bytewise if the block has to move
+        /// @retval null if fails, the old block is left untouched
+        T* reallocate(T* p, size_t, size_t n) { return (T*) ::realloc((void*)p, n * sizeof(T)); }
     };
+
+    namespace detail {
+        template <typename A, typename T, typename = void> struct trait_has_reallocate : etl::false_type {};
+        template <typename A, typename T> struct trait_has_reallocate<A, T, 
+            etl::void_t<decltype(etl::declval<A&>().reallocate(etl::declval<T*>(), size_t{}, size_t{}))>> : etl::true_type {};
+    }
+
+    /// obtain the same allocator template for a different value type
+    template <typename A, typename U> struct allocator_rebind;
+    template <template <typename> typename A, typename T, typename U> struct allocator_rebind<A<T>, U> { typedef A<U> type; };
+    template <typename A, typename U> using allocator_rebind_t = typename etl::allocator_rebind<A, U>::type;
 }
 
-#endif
\ No newline at end of file
+#endif
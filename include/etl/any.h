@@ -140,6 +140,9 @@ namespace Project::etl {
         explicit operator bool() const { return bool(ptr); }
     };
 
+    /// the stored value lives on the heap, moving the object only moves the pointers
+    template <typename A> struct is_trivially_relocatable<Any<A>> : true_type {};
+
     /// create empty any object
     template <typename A = etl::Allocator<uint8_t>> auto
     any() { return etl::Any<A>(); }
@@ -17,109 +17,66 @@ namespace Project::etl {
 
     /// counts the number of consecutive 0 or 1 bits, starting from the least significant bit
     template <size_t N, typename T,
-            typename = enable_if_t<(N == 0u || N == 1u) && is_unsigned_integral_v<T> && sizeof(T) <= 4u>> constexpr uint32_t
+            typename = enable_if_t<(N == 0u || N == 1u) && is_unsigned_integral_v<T> && sizeof(T) <= 8u>> constexpr uint32_t
     count_trailing(T value) {
-        if ((value & 0b1u) == (N ? 0u : 1u)) return 0u;
-
-        uint32_t count = 1u;
-        if constexpr (sizeof(T) == 4u) {
-            if ((value & 0b1111'1111'1111'1111u) == (N ? 0b1111'1111'1111'1111u : 0u)) {
-                value >>= 16u;
-                count += 16u;
-            }
-        }
-        if constexpr (sizeof(T) >= 2u) {
-            if ((value & 0b1111'1111u) == (N ? 0b1111'1111u : 0u)) {
-                value >>= 8u;
-                count += 8u;
-            }
-        }
-        if ((value & 0b1111u) == (N ? 0b1111u : 0u)) {
-            value >>= 4u;
-            count += 4u;
-        }
-        if ((value & 0b11u) == (N ? 0b11u : 0u)) {
-            value >>= 2u;
-            count += 2u;
-        }
-        if ((value & 0b1u) == (N ? 0b1u : 0u)) {
-            value >>= 1u;
-            count += 1u;
-        }
-        count -= (value & 0b1u) == (N ? 0u : 1u);
+        if constexpr (N == 1u) value = T(~value);
+        if (value == 0u) return sizeof(T) * 8u;
+#if defined(__GNUC__)
+        if constexpr (sizeof(T) <= 4u) return uint32_t(__builtin_ctz(uint32_t(value)));
+        else return uint32_t(__builtin_ctzll(uint64_t(value)));
+#else
+        uint32_t count = 0u;
+        for (; (value & 0b1u) == 0u; value >>= 1u) ++count;
         return count;
+#endif
     }
 
-    template <typename T> auto
+    template <typename T> constexpr auto
     count_trailing_zeros(T value) { return etl::count_trailing<0>(value); }
 
-    template <typename T> auto
+    template <typename T> constexpr auto
     count_trailing_ones(T value) { return etl::count_trailing<1>(value); }
 
     /// counts the number of consecutive 0 or 1 bits, starting from the most significant bit
     template <size_t N, typename T,
-            typename = enable_if_t<(N == 0u || N == 1u) && is_unsigned_integral_v<T> && sizeof(T) <= 4u, uint32_t>> constexpr uint32_t
+            typename = enable_if_t<(N == 0u || N == 1u) && is_unsigned_integral_v<T> && sizeof(T) <= 8u>> constexpr uint32_t
     count_leading(T value) {
-        if constexpr (sizeof(T) == 4u) {
-            if ((value & 0b1000'0000'0000'0000'0000'0000'0000'0000u) == (N ? 0u : 0b1000'0000'0000'0000'0000'0000'0000'0000u)) return 0u;
-        }
-        else if constexpr (sizeof(T) == 2u) {
-            if ((value & 0b1000'0000'0000'0000u) == (N ? 0u : 0b1000'0000'0000'0000u)) return 0u;
-        }
-        else if constexpr (sizeof(T) == 1u) {
-            if ((value & 0b1000'0000u) == (N ? 0u : 0b1000'0000u)) return 0u;
-        }
-
-        uint32_t count = 1u;
-        if constexpr (sizeof(T) == 4u) {
-            if ((value & 0b1111'1111'1111'1111'0000'0000'0000'0000u) == (N ? 0b1111'1111'1111'1111'0000'0000'0000'0000u : 0u)) {
-                value <<= 16u;
-                count += 16u;
-            }
-        }
-        if constexpr (sizeof(T) >= 2u) {
-            if ((value & 0b1111'1111'0000'0000'0000'0000'0000'0000u) == (N ? 0b1111'1111'0000'0000'0000'0000'0000'0000u : 0u)) {
-                value <<= 8u;
-                count += 8u;
-            }
-        }
-        if ((value & 0b1111'0000'0000'0000'0000'0000'0000'0000u) == (N ? 0b1111'0000'0000'0000'0000'0000'0000'0000u : 0u)) {
-            value <<= 4u;
-            count += 4u;
-        }
-        if ((value & 0b1100'0000'0000'0000'0000'0000'0000'0000u) == (N ? 0b1100'0000'0000'0000'0000'0000'0000'0000u : 0u)) {
-            value <<= 2u;
-            count += 2u;
-        }
-        if ((value & 0b1000'0000'0000'0000'0000'0000'0000'0000u) == (N ? 0b1000'0000'0000'0000'0000'0000'0000'0000u : 0u)) {
-            value <<= 1u;
-            count += 1u;
-        }
-        count -= (value & 0b1000'0000'0000'0000'0000'0000'0000'0000u) == (N ? 0u : 0b1000'0000'0000'0000'0000'0000'0000'0000u);
+        if constexpr (N == 1u) value = T(~value);
+        if (value == 0u) return sizeof(T) * 8u;
+#if defined(__GNUC__)
+        if constexpr (sizeof(T) <= 4u) return uint32_t(__builtin_clz(uint32_t(value))) - (32u - sizeof(T) * 8u);
+        else return uint32_t(__builtin_clzll(uint64_t(value)));
+#else
+        uint32_t count = 0u;
+        for (T mask = T(1) << (sizeof(T) * 8u - 1u); (value & mask) == 0u; mask >>= 1u) ++count;
         return count;
+#endif
     }
 
-    template <typename T> auto
+    template <typename T> constexpr auto
     count_leading_zero(T value) { return etl::count_leading<0>(value); }
 
-    template <typename T> auto
+    template <typename T> constexpr auto
     count_leading_ones(T value) { return etl::count_leading<1>(value); }
 
     /// finds the smallest number of bits needed to represent the given value
     template <typename T,
-            typename = enable_if_t<is_unsigned_integral_v<T> && sizeof(T) <= 4u>> constexpr uint32_t
+            typename = enable_if_t<is_unsigned_integral_v<T> && sizeof(T) <= 8u>> constexpr uint32_t
     bit_width(T value) { return sizeof(T) * 8 - etl::count_leading_zero(value); }
 
     /// counts the number of 1 bits in an unsigned integer
     template <typename T,
-            typename = enable_if_t<is_unsigned_integral_v<T> && sizeof(T) <= 4u>> constexpr uint32_t
+            typename = enable_if_t<is_unsigned_integral_v<T> && sizeof(T) <= 8u>> constexpr uint32_t
     count_bits(T value) {
-        uint32_t count = value - ((value >> 1U) & 0x5555'5555u);
-        count = ((count >> 2U) & 0x3333'3333u) + (count & 0x3333'3333u);
-        count = ((count >> 4U)  + count) & 0x0F0F'0F0Fu;
-        count = ((count >> 8U)  + count) & 0x00FF'00FFu;
-        count = ((count >> 16U) + count) & 0x0000'00FFu;
-        return count;
+#if defined(__GNUC__)
+        if constexpr (sizeof(T) <= 4u) return uint32_t(__builtin_popcount(uint32_t(value)));
+        else return uint32_t(__builtin_popcountll(uint64_t(value)));
+#else
+        uint64_t count = value - ((value >> 1U) & 0x5555'5555'5555'5555u);
+        count = ((count >> 2U) & 0x3333'3333'3333'3333u) + (count & 0x3333'3333'3333'3333u);
+        count = ((count >> 4U) + count) & 0x0F0F'0F0F'0F0F'0F0Fu;
+        return uint32_t((count * 0x0101'0101'0101'0101u) >> 56U);
+#endif
     }
 
     /// checks if a number is an integral power of two
@@ -0,0 +1,275 @@
+#ifndef ETL_BITSET_H
+#define ETL_BITSET_H
+
+#include "etl/bit.h"
+#include "etl/iter.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Project::etl {
+
+    /// fixed-size sequence of N bits stored in 64-bit words.
+    /// the logic operations work a whole word at a time, count and find use the hardware popcount and ctz
+    /// @note every operation is constexpr, the AVX2 paths are only taken outside of constant evaluation
+    /// @note the unused bits of the last word are always kept zero
+    template <size_t N>
+    class Bitset {
+        static_assert(N > 0, "Bitset needs at least one bit");
+
+    public:
+        static constexpr size_t W = (N + 63) / 64; ///< number of words
+
+    private:
+        static constexpr uint64_t last_mask = N % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (N % 64)) - 1;
+
+        uint64_t words[W] = {};
+
+    public:
+        /// iterator over the indices of the set bits, in increasing order
+        class iterator {
+            const Bitset* bits;
+            size_t i;
+
+        public:
+            constexpr iterator(const Bitset* bits, size_t i) : bits(bits), i(i) {}
+
+            constexpr size_t operator*() const { return i; }
+            constexpr iterator& operator++() { i = bits->find_next(i); return *this; }
+
+            constexpr bool operator==(const iterator& other) const { return i == other.i; }
+            constexpr bool operator!=(const iterator& other) const { return i != other.i; }
+
+            /// number of set bits between two iterators
+            constexpr size_t operator-(const iterator& other) const { return bits->count(other.i, i); }
+        };
+
+        typedef iterator const_iterator;
+
+        /// all bits are zero
+        constexpr Bitset() = default;
+
+        /// the low bits are initialized from an integer
+        constexpr explicit Bitset(uint64_t value) { words[0] = W == 1 ? value & last_mask : value; }
+
+        [[nodiscard]] static constexpr size_t len() { return N; } ///< returns the number of bits
+
+        /// return true if any bit is set
+        constexpr explicit operator bool() const { return any(); }
+
+        constexpr uint64_t* data() { return words; }
+        constexpr const uint64_t* data() const { return words; }
+
+        /// get a word, the bit i of the bitset is the bit i % 64 of the word i / 64
+        constexpr uint64_t word(size_t i) const { return words[i]; }
+
+        constexpr iterator begin() const { return { this, find_first() }; }
+        constexpr iterator end()   const { return { this, N }; }
+
+        constexpr Iter<iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// test a bit, false if the index is out of range
+        constexpr bool test(size_t i) const { return i < N && (words[i / 64] >> (i % 64) & 1u); }
+        constexpr bool operator[](size_t i) const { return test(i); }
+
+        /// set a bit to a value, out of range index is ignored
+        constexpr Bitset& set(size_t i, bool value = true) {
+            if (i >= N) return *this;
+            const uint64_t mask = uint64_t(1) << (i % 64);
+            words[i / 64] = value ? words[i / 64] | mask : words[i / 64] & ~mask;
+            return *this;
+        }
+
+        constexpr Bitset& reset(size_t i) { return set(i, false); }
+
+        constexpr Bitset& flip(size_t i) {
+            if (i < N) words[i / 64] ^= uint64_t(1) << (i % 64);
+            return *this;
+        }
+
+        /// set all bits
+        constexpr Bitset& set() {
+            for (size_t i = 0; i < W; ++i) words[i] = ~uint64_t(0);
+            words[W - 1] = last_mask;
+            return *this;
+        }
+
+        /// reset all bits
+        constexpr Bitset& reset() {
+            for (size_t i = 0; i < W; ++i) words[i] = 0;
+            return *this;
+        }
+
+        /// flip all bits
+        constexpr Bitset& flip() {
+            Bitset ones;
+            return apply_<'^'>(ones.set());
+        }
+
+        /// number of set bits
+        constexpr size_t count() const {
+            size_t res = 0;
+            for (size_t i = 0; i < W; ++i) res += etl::count_bits(words[i]);
+            return res;
+        }
+
+        /// number of set bits in the range [first, last)
+        constexpr size_t count(size_t first, size_t last) const {
+            if (last > N) last = N;
+            if (first >= last) return 0;
+
+            const size_t a = first / 64, b = (last - 1) / 64;
+            const uint64_t lowMask = ~uint64_t(0) << (first % 64);
+            const uint64_t highMask = ~uint64_t(0) >> (63 - (last - 1) % 64);
+            if (a == b) return etl::count_bits(words[a] & lowMask & highMask);
+
+            size_t res = etl::count_bits(words[a] & lowMask) + etl::count_bits(words[b] & highMask);
+            for (size_t i = a + 1; i < b; ++i) res += etl::count_bits(words[i]);
+            return res;
+        }
+
+        constexpr bool all() const {
+            for (size_t i = 0; i + 1 < W; ++i) if (words[i] != ~uint64_t(0)) return false;
+            return words[W - 1] == last_mask;
+        }
+
+        constexpr bool any() const {
+            size_t i = 0;
+#if defined(__AVX2__)
+            if (!__builtin_is_constant_evaluated()) for (; i + 4 <= W; i += 4) {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+                if (!_mm256_testz_si256(a, a)) return true;
+            }
+#endif
+            for (; i < W; ++i) if (words[i] != 0) return true;
+            return false;
+        }
+
+        constexpr bool none() const { return !any(); }
+
+        /// index of the first set bit, N if there is none
+        constexpr size_t find_first() const {
+            for (size_t i = 0; i < W; ++i) {
+                if (words[i] != 0) return i * 64 + etl::count_trailing_zeros(words[i]);
+            }
+            return N;
+        }
+
+        /// index of the first set bit after i, N if there is none
+        constexpr size_t find_next(size_t i) const {
+            if (++i >= N) return N;
+
+            size_t w = i / 64;
+            uint64_t word = words[w] & (~uint64_t(0) << (i % 64));
+            while (word == 0) {
+                if (++w == W) return N;
+                word = words[w];
+            }
+            return w * 64 + etl::count_trailing_zeros(word);
+        }
+
+        constexpr Bitset& operator&=(const Bitset& other) { return apply_<'&'>(other); }
+        constexpr Bitset& operator|=(const Bitset& other) { return apply_<'|'>(other); }
+        constexpr Bitset& operator^=(const Bitset& other) { return apply_<'^'>(other); }
+
+        constexpr Bitset operator&(const Bitset& other) const { Bitset res = *this; return res &= other; }
+        constexpr Bitset operator|(const Bitset& other) const { Bitset res = *this; return res |= other; }
+        constexpr Bitset operator^(const Bitset& other) const { Bitset res = *this; return res ^= other; }
+        constexpr Bitset operator~() const { Bitset res = *this; return res.flip(); }
+
+        /// shift toward the higher indices, the bits shifted past N are dropped
+        constexpr Bitset& operator<<=(size_t shift) {
+            if (shift >= N) return reset();
+
+            const size_t ws = shift / 64, bs = shift % 64;
+            for (size_t i = W; i-- > ws;) {
+                uint64_t word = words[i - ws] << bs;
+                if (bs != 0 && i > ws) word |= words[i - ws - 1] >> (64 - bs);
+                words[i] = word;
+            }
+            for (size_t i = 0; i < ws; ++i) words[i] = 0;
+            words[W - 1] &= last_mask;
+            return *this;
+        }
+
+        /// shift toward the lower indices
+        constexpr Bitset& operator>>=(size_t shift) {
+            if (shift >= N) return reset();
+
+            const size_t ws = shift / 64, bs = shift % 64;
+            for (size_t i = 0; i + ws < W; ++i) {
+                uint64_t word = words[i + ws] >> bs;
+                if (bs != 0 && i + ws + 1 < W) word |= words[i + ws + 1] << (64 - bs);
+                words[i] = word;
+            }
+            for (size_t i = W - ws; i < W; ++i) words[i] = 0;
+            return *this;
+        }
+
+        constexpr Bitset operator<<(size_t shift) const { Bitset res = *this; return res <<= shift; }
+        constexpr Bitset operator>>(size_t shift) const { Bitset res = *this; return res >>= shift; }
+
+        constexpr bool operator==(const Bitset& other) const {
+            size_t i = 0;
+#if defined(__AVX2__)
+            if (!__builtin_is_constant_evaluated()) for (; i + 4 <= W; i += 4) {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other.words + i));
+                const __m256i x = _mm256_xor_si256(a, b);
+                if (!_mm256_testz_si256(x, x)) return false;
+            }
+#endif
+            for (; i < W; ++i) if (words[i] != other.words[i]) return false;
+            return true;
+        }
+
+        constexpr bool operator!=(const Bitset& other) const { return !operator==(other); }
+
+    private:
+        template <char Op>
+        constexpr Bitset& apply_(const Bitset& other) {
+            size_t i = 0;
+#if defined(__AVX2__)
+            if (!__builtin_is_constant_evaluated()) for (; i + 4 <= W; i += 4) {
+                __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other.words + i));
+                if constexpr (Op == '&') a = _mm256_and_si256(a, b);
+                else if constexpr (Op == '|') a = _mm256_or_si256(a, b);
+                else a = _mm256_xor_si256(a, b);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(words + i), a);
+            }
+#endif
+            for (; i < W; ++i) {
+                if constexpr (Op == '&') words[i] &= other.words[i];
+                else if constexpr (Op == '|') words[i] |= other.words[i];
+                else words[i] ^= other.words[i];
+            }
+            return *this;
+        }
+    };
+
+    /// create bitset with the given bits set
+    /// @code constexpr auto b = etl::bitset<100>(1, 5, 99); @endcode
+    template <size_t N, typename... Is> constexpr auto
+    bitset(Is... indices) {
+        Bitset<N> res;
+        (res.set(size_t(indices)), ...);
+        return res;
+    }
+
+    /// type traits
+    template <typename T> struct is_bitset : false_type {};
+    template <size_t N> struct is_bitset<Bitset<N>> : true_type {};
+    template <size_t N> struct is_bitset<const Bitset<N>> : true_type {};
+    template <size_t N> struct is_bitset<volatile Bitset<N>> : true_type {};
+    template <size_t N> struct is_bitset<const volatile Bitset<N>> : true_type {};
+    template <typename T> inline constexpr bool is_bitset_v = is_bitset<T>::value;
+
+    template <size_t N> struct remove_extent<Bitset<N>> { typedef size_t type; };
+    template <size_t N> struct remove_extent<const Bitset<N>> { typedef size_t type; };
+    template <size_t N> struct remove_extent<volatile Bitset<N>> { typedef size_t type; };
+    template <size_t N> struct remove_extent<const volatile Bitset<N>> { typedef size_t type; };
+}
+
+#endif //ETL_BITSET_H
@@ -0,0 +1,297 @@
+#ifndef ETL_BLOOM_FILTER_H
+#define ETL_BLOOM_FILTER_H
+
+#include "etl/vector.h"
+#include "etl/hash.h"
+#include <cmath> // log, pow, ceil
+#include <cstring> // memcpy
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Project::etl::detail {
+    /// widen a hash to 64 bits, both halves are used by the filters so a 32-bit hash is mixed first
+    template <typename H> constexpr uint64_t
+    bloom_hash(H h) {
+        if constexpr (sizeof(H) < sizeof(uint64_t)) return hash_mix(uint64_t(h));
+        else return uint64_t(h);
+    }
+}
+
+namespace Project::etl {
+
+    /// probabilistic set that answers "definitely not present" or "maybe present".
+    /// every key sets k bits of a bit array chosen by double hashing of its 64-bit hash
+    /// @note keys are hashed with etl::hash, the precomputed hash can be passed to insert_hash and contains_hash.
+    /// a hash narrower than 64 bits must be widened with detail::bloom_hash first
+    template <typename A = etl::Allocator<uint64_t>>
+    class BloomFilter {
+        static constexpr double ln2 = 0.693147180559945309417;
+
+        Vector<uint64_t, A> words;
+        size_t nBits = 0;
+        size_t nHashes = 0;
+
+    public:
+        /// empty constructor, the filter has no bits and every lookup answers maybe
+        constexpr BloomFilter() {}
+
+        /// construct a filter sized for a number of keys and a false positive rate,
+        /// the number of bits is -n ln(p) / ln(2)^2 and the number of hashes is ln(2) bits per key
+        /// @note the filter has no bits if the rate is not in the open interval (0, 1) or allocation fails
+        BloomFilter(size_t expectedItems, double falsePositiveRate) {
+            if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) return;
+            const double n = expectedItems ? double(expectedItems) : 1.0;
+            const double bits = std::ceil(-n * std::log(falsePositiveRate) / (ln2 * ln2));
+            if (!(bits < double(size_t(-1) / 2))) return;
+            const size_t nWords = etl::max(size_t(1), (size_t(bits) + 63) / 64);
+            words = Vector<uint64_t, A>(nWords, true);
+            if (words.len() != nWords) return;
+
+            etl::fill(words, 0);
+            nBits = nWords * 64;
+            nHashes = etl::clamp(size_t(std::lround(double(nBits) / n * ln2)), size_t(1), size_t(30));
+        }
+
+        /// copy constructor
+        BloomFilter(const BloomFilter& other) = default;
+
+        /// move constructor
+        BloomFilter(BloomFilter&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment
+        BloomFilter& operator=(const BloomFilter& other) = default;
+
+        /// move assignment, the bits are stolen
+        BloomFilter& operator=(BloomFilter&& other) noexcept {
+            if (this == &other) return *this;
+            words = etl::move(other.words);
+            nBits = etl::exchange(other.nBits, 0);
+            nHashes = etl::exchange(other.nHashes, 0);
+            return *this;
+        }
+
+        [[nodiscard]] size_t bit_len() const { return nBits; } ///< returns the number of bits
+        [[nodiscard]] size_t hash_len() const { return nHashes; } ///< returns the number of bits set per key
+
+        /// return true if the filter has bits
+        explicit operator bool() const { return nBits > 0; }
+
+        /// add a key
+        /// @return false if the filter has no bits
+        template <typename T>
+        bool insert(const T& key) { return insert_hash(detail::bloom_hash(etl::hash(key))); }
+
+        /// check if a key may have been added, false means it has definitely not been added
+        template <typename T>
+        bool contains(const T& key) const { return contains_hash(detail::bloom_hash(etl::hash(key))); }
+
+        /// add a precomputed hash
+        /// @return false if the filter has no bits
+        bool insert_hash(uint64_t h) {
+            if (nBits == 0) return false;
+            uint64_t g = h, step = (h >> 32) | 1;
+            for (size_t i = 0; i < nHashes; ++i, g += step) {
+                const size_t bit = size_t(g % nBits);
+                words.begin()[bit / 64] |= uint64_t(1) << (bit % 64);
+            }
+            return true;
+        }
+
+        /// check if a precomputed hash may have been added
+        bool contains_hash(uint64_t h) const {
+            if (nBits == 0) return true;
+            uint64_t g = h, step = (h >> 32) | 1;
+            for (size_t i = 0; i < nHashes; ++i, g += step) {
+                const size_t bit = size_t(g % nBits);
+                if (!(words.begin()[bit / 64] & (uint64_t(1) << (bit % 64)))) return false;
+            }
+            return true;
+        }
+
+        /// add all keys of another filter with the same shape, e.g. one filled by another thread
+        /// @return false if the number of bits or hashes differ
+        bool merge(const BloomFilter& other) {
+            if (nBits != other.nBits || nHashes != other.nHashes) return false;
+            for (size_t i = 0; i < words.len(); ++i) words.begin()[i] |= other.words.begin()[i];
+            return true;
+        }
+
+        /// merge operator
+        BloomFilter& operator|=(const BloomFilter& other) { merge(other); return *this; }
+
+        /// remove all keys, the bits are kept
+        void clear() { etl::fill(words, 0); }
+    };
+
+    /// bloom filter whose bits are split in blocks of 256 bits, a key only touches the block chosen by its hash.
+    /// a block is 8 words of 32 bits and the key sets one bit in each word, so a lookup is a single cache line access
+    /// and the 8 bit positions are computed and tested at once with SIMD
+    /// @note compared to BloomFilter it needs about 20% more bits for the same false positive rate
+    template <typename A = etl::Allocator<uint32_t>>
+    class BlockedBloomFilter {
+        static constexpr size_t block_words = 8;
+        static constexpr size_t block_align = block_words * sizeof(uint32_t);
+
+        Vector<uint32_t, A> storage;    ///< over-allocated so that the blocks can be aligned to their size
+        size_t nBlocks = 0;
+
+    public:
+        /// empty constructor, the filter has no blocks and every lookup answers maybe
+        constexpr BlockedBloomFilter() {}
+
+        /// construct a filter sized for a number of keys and a false positive rate,
+        /// the number of bits is -8n / ln(1 - p^(1/8)) since each of the 8 words of a block gets one bit per key
+        /// @note the filter has no blocks if the rate is not in the open interval (0, 1) or allocation fails
+        BlockedBloomFilter(size_t expectedItems, double falsePositiveRate) {
+            if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0)) return;
+            const double n = expectedItems ? double(expectedItems) : 1.0;
+            const double bits = std::ceil(-8.0 * n / std::log(1.0 - std::pow(falsePositiveRate, 1.0 / 8)));
+            if (!(bits < double(size_t(-1) / 2))) return;
+            const size_t blocks = etl::max(size_t(1), (size_t(bits) + 255) / 256);
+            const size_t nWords = blocks * block_words + block_words - 1;
+            storage = Vector<uint32_t, A>(nWords, true);
+            if (storage.len() != nWords) return;
+
+            etl::fill(storage, 0);
+            nBlocks = blocks;
+        }
+
+        /// copy constructor, the blocks are realigned in the new storage
+        BlockedBloomFilter(const BlockedBloomFilter& other) { *this = other; }
+
+        /// move constructor
+        BlockedBloomFilter(BlockedBloomFilter&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment
+        BlockedBloomFilter& operator=(const BlockedBloomFilter& other) {
+            if (this == &other) return *this;
+            storage = Vector<uint32_t, A>(other.storage.len(), true);
+            nBlocks = storage.len() == other.storage.len() ? other.nBlocks : 0;
+            ::memcpy(blocks_(), other.blocks_(), nBlocks * block_align);
+            return *this;
+        }
+
+        /// move assignment, the storage is stolen together with its alignment
+        BlockedBloomFilter& operator=(BlockedBloomFilter&& other) noexcept {
+            if (this == &other) return *this;
+            storage = etl::move(other.storage);
+            nBlocks = etl::exchange(other.nBlocks, 0);
+            return *this;
+        }
+
+        [[nodiscard]] size_t bit_len() const { return nBlocks * 256; } ///< returns the number of bits
+
+        /// return true if the filter has blocks
+        explicit operator bool() const { return nBlocks > 0; }
+
+        /// add a key
+        /// @return false if the filter has no blocks
+        template <typename T>
+        bool insert(const T& key) { return insert_hash(detail::bloom_hash(etl::hash(key))); }
+
+        /// check if a key may have been added, false means it has definitely not been added
+        template <typename T>
+        bool contains(const T& key) const { return contains_hash(detail::bloom_hash(etl::hash(key))); }
+
+        /// add a precomputed hash
+        /// @return false if the filter has no blocks
+        bool insert_hash(uint64_t h) {
+            if (nBlocks == 0) return false;
+            uint32_t* block = blocks_() + block_index_(h) * block_words;
+#if defined(__AVX2__)
+            auto p = reinterpret_cast<__m256i*>(block);
+            _mm256_store_si256(p, _mm256_or_si256(_mm256_load_si256(p), mask_(uint32_t(h))));
+#else
+            uint32_t mask[block_words];
+            mask_(uint32_t(h), mask);
+            for (size_t i = 0; i < block_words; ++i) block[i] |= mask[i];
+#endif
+            return true;
+        }
+
+        /// check if a precomputed hash may have been added
+        bool contains_hash(uint64_t h) const {
+            if (nBlocks == 0) return true;
+            const uint32_t* block = blocks_() + block_index_(h) * block_words;
+#if defined(__AVX2__)
+            // true if every bit of the mask is set in the block
+            return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), mask_(uint32_t(h)));
+#elif defined(__SSE2__)
+            uint32_t mask[block_words];
+            mask_(uint32_t(h), mask);
+            auto lo = _mm_andnot_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask)));
+            auto hi = _mm_andnot_si128(_mm_load_si128(reinterpret_cast<const __m128i*>(block + 4)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask + 4)));
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(lo, hi), _mm_setzero_si128())) == 0xFFFF;
+#else
+            uint32_t mask[block_words];
+            mask_(uint32_t(h), mask);
+            uint32_t missing = 0;
+            for (size_t i = 0; i < block_words; ++i) missing |= mask[i] & ~block[i];
+            return missing == 0;
+#endif
+        }
+
+        /// add all keys of another filter with the same number of blocks, e.g. one filled by another thread
+        /// @return false if the number of blocks differ
+        bool merge(const BlockedBloomFilter& other) {
+            if (nBlocks != other.nBlocks) return false;
+            uint32_t* dst = blocks_();
+            const uint32_t* src = other.blocks_();
+            for (size_t i = 0; i < nBlocks * block_words; ++i) dst[i] |= src[i];
+            return true;
+        }
+
+        /// merge operator
+        BlockedBloomFilter& operator|=(const BlockedBloomFilter& other) { merge(other); return *this; }
+
+        /// remove all keys, the blocks are kept
+        void clear() { etl::fill(storage, 0); }
+
+    private:
+        /// odd constants that spread a 32-bit key over the 8 words of a block
+        static constexpr uint32_t salts[block_words] = {
+            0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du, 0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u,
+        };
+
+        uint32_t* blocks_() const {
+            auto p = reinterpret_cast<uintptr_t>(storage.data());
+            return reinterpret_cast<uint32_t*>((p + block_align - 1) & ~uintptr_t(block_align - 1));
+        }
+
+        /// the high half of the hash chooses the block, the low half chooses the bits
+        size_t block_index_(uint64_t h) const { return size_t((h >> 32) % nBlocks); }
+
+#if defined(__AVX2__)
+        static __m256i mask_(uint32_t key) {
+            const auto salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salts));
+            const auto shift = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(int(key)), salt), 27);
+            return _mm256_sllv_epi32(_mm256_set1_epi32(1), shift);
+        }
+#else
+        static void mask_(uint32_t key, uint32_t (&mask)[block_words]) {
+            for (size_t i = 0; i < block_words; ++i) mask[i] = uint32_t(1) << ((key * salts[i]) >> 27);
+        }
+#endif
+    };
+
+    /// type traits
+    template <typename T> struct is_bloom_filter : false_type {};
+    template <typename A> struct is_bloom_filter<BloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<const BloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<volatile BloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<const volatile BloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<BlockedBloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<const BlockedBloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<volatile BlockedBloomFilter<A>> : true_type {};
+    template <typename A> struct is_bloom_filter<const volatile BlockedBloomFilter<A>> : true_type {};
+    template <typename T> inline constexpr bool is_bloom_filter_v = is_bloom_filter<T>::value;
+
+    template <typename A> struct is_trivially_relocatable<BloomFilter<A>> : true_type {};
+    template <typename A> struct is_trivially_relocatable<BlockedBloomFilter<A>> : true_type {};
+}
+
+#endif //ETL_BLOOM_FILTER_H
@@ -0,0 +1,719 @@
+#ifndef ETL_BTREE_MAP_H
+#define ETL_BTREE_MAP_H
+
+#include "etl/algorithm.h"
+#include "etl/allocator.h"
+#include "etl/vector.h"
+#include <cstring> // memmove
+#include <new>
+
+#ifndef ETL_BTREE_NODE_SIZE
+#define ETL_BTREE_NODE_SIZE 256 ///< approximate size of the keys and values of a node in bytes, a few cache lines
+#endif
+
+namespace Project::etl {
+
+    /// ordered collection of key-value pairs, keys are unique.
+    /// it is a B+ tree: the pairs live in leaves linked to each other and the inner nodes only hold separator keys,
+    /// every node is sized to a few cache lines and its keys are stored contiguously apart from the values and child pointers
+    /// so that the search inside a node touches as little memory as possible.
+    /// insert and remove are O(log n) and only move the items of one or two nodes
+    /// @note the key type must be comparable with operator<
+    /// @note inserting or removing a pair may move the other pairs of the same node, pointers to values don't stay valid
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>>
+    class BTreeMap {
+        static constexpr size_t node_len_(size_t itemSize) {
+            size_t n = ETL_BTREE_NODE_SIZE / itemSize;
+            return n < 4 ? 4 : n;
+        }
+
+        static constexpr size_t L = node_len_(sizeof(K) + sizeof(V));       ///< maximum number of pairs in a leaf
+        static constexpr size_t I = node_len_(sizeof(K) + sizeof(void*));   ///< maximum number of keys in an inner node
+        static constexpr size_t min_leaf_len = L / 2;
+        static constexpr size_t min_inner_len = I / 2;
+
+        static_assert(L <= 0xFFFF && I <= 0xFFFF, "Node size is too big");
+
+        struct Node {
+            uint16_t n;
+            bool leaf;
+        };
+
+        struct Leaf : Node {
+            Leaf* prev;
+            Leaf* next;
+            alignas(K) unsigned char keyStorage[L * sizeof(K)];
+            alignas(V) unsigned char valueStorage[L * sizeof(V)];
+
+            K* keys() { return reinterpret_cast<K*>(keyStorage); }
+            V* values() { return reinterpret_cast<V*>(valueStorage); }
+        };
+
+        struct Inner : Node {
+            alignas(K) unsigned char keyStorage[I * sizeof(K)];
+            Node* children[I + 1];  ///< keys of children[i] are less than keys()[i], keys of children[i + 1] are not
+
+            K* keys() { return reinterpret_cast<K*>(keyStorage); }
+        };
+
+        using leaf_allocator = etl::allocator_rebind_t<A, Leaf>;
+        using inner_allocator = etl::allocator_rebind_t<A, Inner>;
+
+        Node* root = nullptr;
+        Leaf* first = nullptr;
+        Leaf* last = nullptr;
+        size_t nItems = 0;
+
+    public:
+        template <typename U>
+        class Iterator;
+
+        typedef K Key;
+        typedef V Value;
+        typedef Iterator<V> iterator;
+        typedef Iterator<const V> const_iterator;
+        typedef A Alloc;
+
+        /// maximum number of pairs in a leaf
+        static constexpr size_t leaf_len = L;
+
+        /// maximum number of keys in an inner node
+        static constexpr size_t inner_len = I;
+
+        /// empty constructor
+        constexpr BTreeMap() {}
+
+        /// construct from initializer list, the items don't need to be sorted
+        BTreeMap(std::initializer_list<Pair<K, V>>&& items) {
+            for (auto& it : items) insert(etl::move(it.x), etl::move(it.y));
+        }
+
+        /// copy constructor
+        BTreeMap(const BTreeMap& other) { *this = other; }
+
+        /// move constructor
+        BTreeMap(BTreeMap&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment, the tree is rebuilt bottom-up from the sorted pairs of the other map
+        BTreeMap& operator=(const BTreeMap& other) {
+            if (this == &other) return *this;
+            load_sorted(other.begin(), other.end());
+            return *this;
+        }
+
+        /// move assignment, the nodes are stolen
+        BTreeMap& operator=(BTreeMap&& other) noexcept {
+            if (this == &other) return *this;
+            clear();
+            root = etl::exchange(other.root, nullptr);
+            first = etl::exchange(other.first, nullptr);
+            last = etl::exchange(other.last, nullptr);
+            nItems = etl::exchange(other.nItems, 0);
+            return *this;
+        }
+
+        /// destructor
+        ~BTreeMap() { clear(); }
+
+        [[nodiscard]] size_t len() const { return nItems; } ///< returns the number of pairs
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        iterator begin() { return { first, 0 }; }
+        iterator end()   { return { last, last ? int(last->n) : 0 }; }
+
+        const_iterator begin() const { return { first, 0 }; }
+        const_iterator end()   const { return { last, last ? int(last->n) : 0 }; }
+
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// check if a key is in this map
+        bool has(const K& key) const { return static_cast<bool>(find(key)); }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        V& get(const K& key) { return *find(key); }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        const V& get(const K& key) const { return *find(key); }
+
+        /// get a value given the key. if the key does not exist, insert new pair and return default constructed V
+        /// @warning it will be error null dereference if allocation fails
+        template <typename KK>
+        V& operator[](KK&& key) {
+            K k(etl::forward<KK>(key));
+            auto res = emplace_(k);
+            return *res.x;
+        }
+
+        /// get a value given the key. if the key does not exist, return default constructed V
+        const V& operator[](const K& key) const {
+            auto res = find(key);
+            if (res) return *res;
+            static const auto v = Value{};
+            return v;
+        }
+
+        /// insert a key-value pair if the key does not exist
+        /// @return true if the pair is inserted
+        template <typename KK, typename VV>
+        bool insert(KK&& key, VV&& value) {
+            K k(etl::forward<KK>(key));
+            return emplace_(k, etl::forward<VV>(value)).y;
+        }
+
+        /// replace the content with the pairs of a sequence sorted by strictly increasing keys.
+        /// the leaves are filled from left to right and the inner levels are built on top of them,
+        /// which is O(n) and packs the nodes tighter than inserting the pairs one by one
+        /// @return false if the pairs are not sorted or allocation fails, the map is left empty
+        template <typename It>
+        bool load_sorted(It from, It to) {
+            clear();
+
+            size_t n = 0;
+            for (auto it = from, prev = from; it != to; prev = it, ++it, ++n) {
+                if (n > 0 && !((*prev).x < (*it).x)) return false;
+            }
+            if (n == 0) return true;
+
+            // spread the pairs evenly so that every leaf is at least half full
+            const size_t nLeaves = (n + L - 1) / L;
+            auto level = Vector<Node*>();
+            if (!level.reserve(nLeaves)) return false;
+
+            auto it = from;
+            Leaf* prev = nullptr;
+            for (size_t i = 0; i < nLeaves; ++i) {
+                Leaf* leaf = create_leaf_();
+                if (leaf == nullptr) return abort_load_(level, 0);
+
+                const size_t cnt = n / nLeaves + (i < n % nLeaves);
+                for (; leaf->n < cnt; ++it) {
+                    new(leaf->keys() + leaf->n) K((*it).x);
+                    new(leaf->values() + leaf->n) V((*it).y);
+                    ++leaf->n;
+                }
+
+                leaf->prev = prev;
+                if (prev) prev->next = leaf;
+                else first = leaf;
+                prev = leaf;
+                nItems += cnt;
+                level += leaf;
+            }
+            last = prev;
+
+            // build the inner levels on top until there is only one node left
+            while (level.len() > 1) {
+                const size_t nChildren = level.len();
+                const size_t nNodes = (nChildren + I) / (I + 1);
+                auto next = Vector<Node*>();
+                if (!next.reserve(nNodes)) return abort_load_(level, 0);
+
+                for (size_t i = 0, k = 0; i < nNodes; ++i) {
+                    Inner* inner = create_inner_();
+                    if (inner == nullptr) {
+                        abort_load_(next, 0);
+                        return abort_load_(level, k);
+                    }
+
+                    const size_t cnt = nChildren / nNodes + (i < nChildren % nNodes);
+                    inner->children[0] = level[int(k)];
+                    for (size_t j = 1; j < cnt; ++j) {
+                        Node* child = level[int(k + j)];
+                        new(inner->keys() + inner->n) K(min_key_(child));
+                        inner->children[++inner->n] = child;
+                    }
+                    next += inner;
+                    k += cnt;
+                }
+                level = etl::move(next);
+            }
+
+            root = level[0];
+            return true;
+        }
+
+        /// replace the content with the pairs of a sequence sorted by strictly increasing keys
+        /// @return false if the pairs are not sorted or allocation fails, the map is left empty
+        template <typename Sequence>
+        bool load_sorted(const Sequence& seq) { return load_sorted(etl::begin(seq), etl::end(seq)); }
+
+        /// remove key-value pair given the key
+        bool remove(const K& key) {
+            if (root == nullptr || !remove_(root, key))
+                return false;
+
+            if (root->n == 0) {
+                if (root->leaf) {
+                    leaf_allocator().deallocate(static_cast<Leaf*>(root), 1);
+                    root = first = last = nullptr;
+                } else {
+                    auto old = static_cast<Inner*>(root);
+                    root = old->children[0];
+                    inner_allocator().deallocate(old, 1);
+                }
+            }
+            return true;
+        }
+
+        /// delete all pairs and nodes
+        void clear() {
+            if (root) destroy_(root);
+            root = first = last = nullptr;
+            nItems = 0;
+        }
+
+        V* find(const K& key) {
+            if (root == nullptr) return nullptr;
+            Leaf* leaf = find_leaf_(key);
+            size_t i = lower_(leaf->keys(), leaf->n, key);
+            return i < leaf->n && !(key < leaf->keys()[i]) ? leaf->values() + i : nullptr;
+        }
+
+        const V* find(const K& key) const { return const_cast<BTreeMap*>(this)->find(key); }
+
+        /// iterator to the first pair whose key is not less than the given key
+        iterator lower_bound(const K& key) { return bound_<iterator>(key, false); }
+        const_iterator lower_bound(const K& key) const { return bound_<const_iterator>(key, false); }
+
+        /// iterator to the first pair whose key is greater than the given key
+        iterator upper_bound(const K& key) { return bound_<iterator>(key, true); }
+        const_iterator upper_bound(const K& key) const { return bound_<const_iterator>(key, true); }
+
+        /// iter object of the pairs whose keys are in [lo, hi)
+        Iter<iterator> range(const K& lo, const K& hi) {
+            auto lower = lower_bound(lo);
+            return Iter(lower, lo < hi ? lower_bound(hi) : lower, 1);
+        }
+
+        /// iter object of the pairs whose keys are in [lo, hi)
+        Iter<const_iterator> range(const K& lo, const K& hi) const {
+            auto lower = lower_bound(lo);
+            return Iter(lower, lo < hi ? lower_bound(hi) : lower, 1);
+        }
+
+    private:
+        /// result of inserting into a subtree, if the subtree root is split the new right sibling and its separator are promoted
+        struct Promote {
+            Node* right = nullptr;
+            alignas(K) unsigned char storage[sizeof(K)];
+
+            K& key() { return *reinterpret_cast<K*>(storage); }
+        };
+
+        /// number of keys less than the given key.
+        /// for arithmetic keys the whole node is scanned without branches, which the compiler turns into SIMD compares
+        static size_t lower_(const K* keys, size_t n, const K& key) {
+            if constexpr (etl::is_arithmetic_v<K>) {
+                size_t res = 0;
+                for (size_t i = 0; i < n; ++i) res += keys[i] < key;
+                return res;
+            } else {
+                return etl::lower_bound(keys, keys + n, key) - keys;
+            }
+        }
+
+        /// number of keys not greater than the given key
+        static size_t upper_(const K* keys, size_t n, const K& key) {
+            if constexpr (etl::is_arithmetic_v<K>) {
+                size_t res = 0;
+                for (size_t i = 0; i < n; ++i) res += !(key < keys[i]);
+                return res;
+            } else {
+                return etl::upper_bound(keys, keys + n, key) - keys;
+            }
+        }
+
+        /// move constructed items to possibly overlapping storage, the source items are destroyed
+        template <typename T>
+        static void relocate_(T* dst, T* src, size_t cnt) {
+            if (cnt == 0 || dst == src) return;
+            if constexpr (etl::is_trivially_relocatable_v<T>) {
+                ::memmove((void*)dst, (const void*)src, cnt * sizeof(T));
+            } else if (dst < src) {
+                for (size_t i = 0; i < cnt; ++i) { new(dst + i) T(etl::move(src[i])); src[i].~T(); }
+            } else {
+                for (size_t i = cnt; i-- > 0;) { new(dst + i) T(etl::move(src[i])); src[i].~T(); }
+            }
+        }
+
+        static void move_children_(Node** dst, Node** src, size_t cnt) {
+            ::memmove((void*)dst, (const void*)src, cnt * sizeof(Node*));
+        }
+
+        static const K& min_key_(Node* node) {
+            while (!node->leaf) node = static_cast<Inner*>(node)->children[0];
+            return static_cast<Leaf*>(node)->keys()[0];
+        }
+
+        Leaf* create_leaf_() {
+            Leaf* leaf = leaf_allocator().allocate(1);
+            if (leaf == nullptr) return nullptr;
+            new(leaf) Leaf;
+            leaf->n = 0;
+            leaf->leaf = true;
+            leaf->prev = leaf->next = nullptr;
+            return leaf;
+        }
+
+        Inner* create_inner_() {
+            Inner* inner = inner_allocator().allocate(1);
+            if (inner == nullptr) return nullptr;
+            new(inner) Inner;
+            inner->n = 0;
+            inner->leaf = false;
+            return inner;
+        }
+
+        void destroy_(Node* node) {
+            if (node->leaf) {
+                auto leaf = static_cast<Leaf*>(node);
+                for (size_t i = 0; i < leaf->n; ++i) {
+                    leaf->keys()[i].~K();
+                    leaf->values()[i].~V();
+                }
+                leaf_allocator().deallocate(leaf, 1);
+            } else {
+                auto inner = static_cast<Inner*>(node);
+                for (size_t i = 0; i < inner->n; ++i) inner->keys()[i].~K();
+                for (size_t i = 0; i <= inner->n; ++i) destroy_(inner->children[i]);
+                inner_allocator().deallocate(inner, 1);
+            }
+        }
+
+        /// free the nodes of a partially built tree that are not owned by a parent yet, starting from the given index
+        bool abort_load_(Vector<Node*>& nodes, size_t index) {
+            for (; index < nodes.len(); ++index) destroy_(nodes[int(index)]);
+            root = first = last = nullptr;
+            nItems = 0;
+            return false;
+        }
+
+        Leaf* find_leaf_(const K& key) const {
+            Node* node = root;
+            while (!node->leaf) {
+                auto inner = static_cast<Inner*>(node);
+                node = inner->children[upper_(inner->keys(), inner->n, key)];
+            }
+            return static_cast<Leaf*>(node);
+        }
+
+        template <typename It>
+        It bound_(const K& key, bool upper) const {
+            if (root == nullptr) return {};
+            Leaf* leaf = find_leaf_(key);
+            size_t i = upper ? upper_(leaf->keys(), leaf->n, key) : lower_(leaf->keys(), leaf->n, key);
+            if (i == leaf->n && leaf->next) return { leaf->next, 0 };
+            return { leaf, int(i) };
+        }
+
+        /// insert at the root, a new root is allocated upfront if the root is full so that a split never fails halfway
+        template <typename... Args>
+        Pair<V*, bool> emplace_(K& key, Args&&... args) {
+            if (root == nullptr) {
+                Leaf* leaf = create_leaf_();
+                if (leaf == nullptr) return { nullptr, false };
+                root = first = last = leaf;
+            }
+
+            Inner* newRoot = nullptr;
+            if (root->n == (root->leaf ? L : I) && (newRoot = create_inner_()) == nullptr)
+                return { nullptr, false };
+
+            Promote up;
+            auto res = insert_(root, key, up, etl::forward<Args>(args)...);
+            if (up.right) {
+                new(newRoot->keys()) K(etl::move(up.key()));
+                up.key().~K();
+                newRoot->n = 1;
+                newRoot->children[0] = root;
+                newRoot->children[1] = up.right;
+                root = newRoot;
+            } else if (newRoot) {
+                inner_allocator().deallocate(newRoot, 1);
+            }
+            return res;
+        }
+
+        template <typename... Args>
+        Pair<V*, bool> insert_(Node* node, K& key, Promote& up, Args&&... args) {
+            if (node->leaf) {
+                auto leaf = static_cast<Leaf*>(node);
+                size_t i = lower_(leaf->keys(), leaf->n, key);
+                if (i < leaf->n && !(key < leaf->keys()[i])) return { leaf->values() + i, false };
+
+                if (leaf->n == L) {
+                    Leaf* right = create_leaf_();
+                    if (right == nullptr) return { nullptr, false };
+
+                    constexpr size_t mid = L / 2;
+                    relocate_(right->keys(), leaf->keys() + mid, L - mid);
+                    relocate_(right->values(), leaf->values() + mid, L - mid);
+                    right->n = L - mid;
+                    leaf->n = mid;
+
+                    right->prev = leaf;
+                    right->next = leaf->next;
+                    if (leaf->next) leaf->next->prev = right;
+                    else last = right;
+                    leaf->next = right;
+
+                    up.right = right;
+                    if (i > mid) { leaf = right; i -= mid; }
+                }
+
+                relocate_(leaf->keys() + i + 1, leaf->keys() + i, leaf->n - i);
+                relocate_(leaf->values() + i + 1, leaf->values() + i, leaf->n - i);
+                new(leaf->keys() + i) K(etl::move(key));
+                new(leaf->values() + i) V(etl::forward<Args>(args)...);
+                ++leaf->n;
+                ++nItems;
+
+                if (up.right) new(up.storage) K(static_cast<Leaf*>(up.right)->keys()[0]);
+                return { leaf->values() + i, true };
+            }
+
+            auto inner = static_cast<Inner*>(node);
+            const size_t i = upper_(inner->keys(), inner->n, key);
+
+            // the sibling is allocated before descending, a child that has been split must always find a place
+            Inner* right = nullptr;
+            if (inner->n == I && (right = create_inner_()) == nullptr)
+                return { nullptr, false };
+
+            Promote child;
+            auto res = insert_(inner->children[i], key, child, etl::forward<Args>(args)...);
+            if (child.right == nullptr) {
+                if (right) inner_allocator().deallocate(right, 1);
+                return res;
+            }
+
+            Inner* target = inner;
+            size_t j = i;
+            if (right) {
+                // keys()[mid] is promoted, the keys after it go to the right sibling
+                constexpr size_t mid = I / 2;
+                relocate_(right->keys(), inner->keys() + mid + 1, I - mid - 1);
+                move_children_(right->children, inner->children + mid + 1, I - mid);
+                right->n = I - mid - 1;
+
+                new(up.storage) K(etl::move(inner->keys()[mid]));
+                inner->keys()[mid].~K();
+                inner->n = mid;
+                up.right = right;
+
+                if (i > mid) { target = right; j = i - mid - 1; }
+            }
+
+            relocate_(target->keys() + j + 1, target->keys() + j, target->n - j);
+            move_children_(target->children + j + 2, target->children + j + 1, target->n - j);
+            new(target->keys() + j) K(etl::move(child.key()));
+            child.key().~K();
+            target->children[j + 1] = child.right;
+            ++target->n;
+            return res;
+        }
+
+        bool remove_(Node* node, const K& key) {
+            if (node->leaf) {
+                auto leaf = static_cast<Leaf*>(node);
+                size_t i = lower_(leaf->keys(), leaf->n, key);
+                if (i == leaf->n || key < leaf->keys()[i]) return false;
+
+                leaf->keys()[i].~K();
+                leaf->values()[i].~V();
+                relocate_(leaf->keys() + i, leaf->keys() + i + 1, leaf->n - i - 1);
+                relocate_(leaf->values() + i, leaf->values() + i + 1, leaf->n - i - 1);
+                --leaf->n;
+                --nItems;
+                return true;
+            }
+
+            auto inner = static_cast<Inner*>(node);
+            const size_t i = upper_(inner->keys(), inner->n, key);
+            Node* child = inner->children[i];
+            if (!remove_(child, key)) return false;
+
+            if (child->n < (child->leaf ? min_leaf_len : min_inner_len)) rebalance_(inner, i);
+            return true;
+        }
+
+        /// fix an underfull child by borrowing from a sibling, or by merging it with a sibling that has no spare items
+        void rebalance_(Inner* parent, size_t i) {
+            const size_t min = parent->children[i]->leaf ? min_leaf_len : min_inner_len;
+            Node* left = i > 0 ? parent->children[i - 1] : nullptr;
+            Node* right = i < parent->n ? parent->children[i + 1] : nullptr;
+
+            if (left && left->n > min) borrow_left_(parent, i);
+            else if (right && right->n > min) borrow_right_(parent, i);
+            else if (left) merge_(parent, i - 1);
+            else merge_(parent, i);
+        }
+
+        void borrow_left_(Inner* parent, size_t i) {
+            if (parent->children[i]->leaf) {
+                auto node = static_cast<Leaf*>(parent->children[i]);
+                auto left = static_cast<Leaf*>(parent->children[i - 1]);
+                const size_t k = left->n - 1;
+                relocate_(node->keys() + 1, node->keys(), node->n);
+                relocate_(node->values() + 1, node->values(), node->n);
+                relocate_(node->keys(), left->keys() + k, 1);
+                relocate_(node->values(), left->values() + k, 1);
+                --left->n;
+                ++node->n;
+                parent->keys()[i - 1] = node->keys()[0];
+            } else {
+                auto node = static_cast<Inner*>(parent->children[i]);
+                auto left = static_cast<Inner*>(parent->children[i - 1]);
+                const size_t k = left->n - 1;
+                relocate_(node->keys() + 1, node->keys(), node->n);
+                move_children_(node->children + 1, node->children, node->n + 1);
+                new(node->keys()) K(etl::move(parent->keys()[i - 1]));
+                node->children[0] = left->children[k + 1];
+                parent->keys()[i - 1] = etl::move(left->keys()[k]);
+                left->keys()[k].~K();
+                --left->n;
+                ++node->n;
+            }
+        }
+
+        void borrow_right_(Inner* parent, size_t i) {
+            if (parent->children[i]->leaf) {
+                auto node = static_cast<Leaf*>(parent->children[i]);
+                auto right = static_cast<Leaf*>(parent->children[i + 1]);
+                relocate_(node->keys() + node->n, right->keys(), 1);
+                relocate_(node->values() + node->n, right->values(), 1);
+                relocate_(right->keys(), right->keys() + 1, right->n - 1);
+                relocate_(right->values(), right->values() + 1, right->n - 1);
+                --right->n;
+                ++node->n;
+                parent->keys()[i] = right->keys()[0];
+            } else {
+                auto node = static_cast<Inner*>(parent->children[i]);
+                auto right = static_cast<Inner*>(parent->children[i + 1]);
+                new(node->keys() + node->n) K(etl::move(parent->keys()[i]));
+                node->children[node->n + 1] = right->children[0];
+                parent->keys()[i] = etl::move(right->keys()[0]);
+                right->keys()[0].~K();
+                relocate_(right->keys(), right->keys() + 1, right->n - 1);
+                move_children_(right->children, right->children + 1, right->n);
+                --right->n;
+                ++node->n;
+            }
+        }
+
+        /// merge children[j + 1] into children[j] and remove the separator between them
+        void merge_(Inner* parent, size_t j) {
+            if (parent->children[j]->leaf) {
+                auto left = static_cast<Leaf*>(parent->children[j]);
+                auto right = static_cast<Leaf*>(parent->children[j + 1]);
+                relocate_(left->keys() + left->n, right->keys(), right->n);
+                relocate_(left->values() + left->n, right->values(), right->n);
+                left->n += right->n;
+
+                left->next = right->next;
+                if (right->next) right->next->prev = left;
+                else last = left;
+                leaf_allocator().deallocate(right, 1);
+            } else {
+                auto left = static_cast<Inner*>(parent->children[j]);
+                auto right = static_cast<Inner*>(parent->children[j + 1]);
+                new(left->keys() + left->n) K(etl::move(parent->keys()[j]));
+                relocate_(left->keys() + left->n + 1, right->keys(), right->n);
+                move_children_(left->children + left->n + 1, right->children, right->n + 1);
+                left->n += right->n + 1;
+                inner_allocator().deallocate(right, 1);
+            }
+
+            parent->keys()[j].~K();
+            relocate_(parent->keys() + j, parent->keys() + j + 1, parent->n - j - 1);
+            move_children_(parent->children + j + 1, parent->children + j + 2, parent->n - j - 1);
+            --parent->n;
+        }
+    };
+
+    /// iterates the pairs in key order by following the links between leaves,
+    /// dereferencing yields a pair of references to the key and the value
+    template <typename K, typename V, typename A>
+    template <typename U>
+    class BTreeMap<K, V, A>::Iterator {
+        friend class BTreeMap<K, V, A>;
+        Leaf* leaf;
+        int i;
+
+        Iterator(Leaf* leaf, int i) : leaf(leaf), i(i) {}
+
+    public:
+        /// empty constructor
+        Iterator() : leaf(nullptr), i(0) {}
+
+        Pair<const K&, U&> operator*() const { return { leaf->keys()[i], leaf->values()[i] }; }
+
+        const K& key() const { return leaf->keys()[i]; }
+        U& value() const { return leaf->values()[i]; }
+
+        bool operator==(const Iterator& other) const { return leaf == other.leaf && i == other.i; }
+        bool operator!=(const Iterator& other) const { return !operator==(other); }
+
+        Iterator& operator++() {
+            if (++i == leaf->n && leaf->next) { leaf = leaf->next; i = 0; }
+            return *this;
+        }
+
+        Iterator& operator--() {
+            if (i == 0 && leaf && leaf->prev) { leaf = leaf->prev; i = leaf->n - 1; }
+            else --i;
+            return *this;
+        }
+
+        Iterator operator++(int) { auto res = *this; ++*this; return res; } // NOLINT
+        Iterator operator--(int) { auto res = *this; --*this; return res; } // NOLINT
+
+        Iterator operator+(int n) const { auto res = *this; return res += n; }
+        Iterator operator-(int n) const { auto res = *this; return res -= n; }
+        Iterator& operator+=(int n) { for (; n > 0; --n) ++*this; for (; n < 0; ++n) --*this; return *this; }
+        Iterator& operator-=(int n) { return *this += -n; }
+
+        /// distance to a preceding iterator, it walks over the leaves in between
+        size_t operator-(const Iterator& other) const {
+            if (leaf == nullptr) return 0;
+            size_t res = 0;
+            int j = other.i;
+            for (Leaf* l = other.leaf; l != leaf; l = l->next, j = 0) res += l->n - j;
+            return res + (i - j);
+        }
+    };
+
+    /// create empty btree map
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> constexpr auto
+    btree_map() { return BTreeMap<K, V, A> {}; }
+
+    /// create btree map from initializer list, type is explicitly specified
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> auto
+    btree_map(std::initializer_list<Pair<K,V>>&& items) { return BTreeMap<K, V, A>(etl::move(items)); }
+
+    /// type traits
+    template <typename T> struct is_btree_map : false_type {};
+    template <typename K, typename V, typename A> struct is_btree_map<BTreeMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_btree_map<const BTreeMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_btree_map<volatile BTreeMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_btree_map<const volatile BTreeMap<K, V, A>> : true_type {};
+    template <typename T> inline constexpr bool is_btree_map_v = is_btree_map<T>::value;
+
+    /// the pairs live in separately allocated nodes, moving the map only moves the pointers
+    template <typename K, typename V, typename A> struct is_trivially_relocatable<BTreeMap<K, V, A>> : true_type {};
+
+    template <typename K, typename V, typename A> struct remove_extent<BTreeMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<const BTreeMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<volatile BTreeMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<const volatile BTreeMap<K, V, A>> { typedef Pair<K, V> type; };
+}
+
+#endif //ETL_BTREE_MAP_H
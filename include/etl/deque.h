@@ -0,0 +1,355 @@
+#ifndef ETL_DEQUE_H
+#define ETL_DEQUE_H
+
+#include "etl/algorithm.h"
+#include "etl/allocator.h"
+#include <cstring> // memmove
+#include <new>
+
+#ifndef ETL_DEQUE_BLOCK_SIZE
+#define ETL_DEQUE_BLOCK_SIZE 512 ///< approximate size of a block in bytes
+#endif
+
+namespace Project::etl {
+
+    /// double-ended queue made of fixed-size blocks and a map of block pointers.
+    /// pushing or popping at either end never moves the other items, so references to them stay valid
+    /// @note only the map of block pointers is reallocated when it runs out of slots,
+    /// the number of items per block is a power of two so that indexing is a shift and a mask
+    template <typename T, typename A = etl::Allocator<T>>
+    class Deque {
+        static constexpr size_t block_len_() {
+            size_t n = ETL_DEQUE_BLOCK_SIZE / sizeof(T), res = 1;
+            while (res * 2 <= n) res *= 2;
+            return res;
+        }
+
+        static constexpr size_t B = block_len_();
+        static constexpr size_t min_map_len = 8;
+
+        using map_allocator = etl::allocator_rebind_t<A, T*>;
+
+        T** map = nullptr;
+        size_t mapLen = 0;
+        size_t head = 0;        ///< position of the first item, counted from the first slot of the map
+        size_t nItems = 0;
+        T* spare = nullptr;     ///< a released block kept to avoid allocation when pushing and popping around a block boundary
+
+    public:
+        template <typename U>
+        class Iterator;
+
+        typedef T value_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef Iterator<T> iterator;
+        typedef Iterator<const T> const_iterator;
+        typedef A Alloc;
+
+        /// number of items in each block
+        static constexpr size_t block_len = B;
+
+        /// empty constructor
+        constexpr Deque() {}
+
+        /// construct from initializer list
+        Deque(std::initializer_list<T>&& items) {
+            for (auto& it : items) push_back(etl::move(it));
+        }
+
+        /// copy constructor
+        Deque(const Deque& other) { *this = other; }
+
+        /// move constructor
+        Deque(Deque&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment
+        Deque& operator=(const Deque& other) {
+            if (this == &other) return *this;
+            clear();
+            for (auto& it : other) push_back(it);
+            return *this;
+        }
+
+        /// move assignment, the map and the blocks are stolen
+        Deque& operator=(Deque&& other) noexcept {
+            if (this == &other) return *this;
+            reset_delete_();
+            map = etl::exchange(other.map, nullptr);
+            mapLen = etl::exchange(other.mapLen, 0);
+            head = etl::exchange(other.head, 0);
+            nItems = etl::exchange(other.nItems, 0);
+            spare = etl::exchange(other.spare, nullptr);
+            return *this;
+        }
+
+        /// destructor
+        ~Deque() { reset_delete_(); }
+
+        [[nodiscard]] size_t len() const { return nItems; } ///< returns the number of items
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        iterator begin() { return { map, head }; }
+        iterator end()   { return { map, head + nItems }; }
+
+        const_iterator begin() const { return { map, head }; }
+        const_iterator end()   const { return { map, head + nItems }; }
+
+        /// get the first item
+        /// @warning make sure the deque is not empty
+        reference front() { return at_(head); }
+        const_reference front() const { return at_(head); }
+
+        /// get the last item
+        /// @warning make sure the deque is not empty
+        reference back() { return at_(head + nItems - 1); }
+        const_reference back() const { return at_(head + nItems - 1); }
+
+        /// get i-th item by dereference, negative index counts from the last item
+        /// @warning it will be error null dereference if index is not valid
+        reference operator[](int i) { return is_valid_index_(i) ? at_(head + i) : *static_cast<T*>(nullptr); }
+        const_reference operator[](int i) const { return is_valid_index_(i) ? at_(head + i) : *static_cast<const T*>(nullptr); }
+
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// slice operator
+        Iter<iterator> operator()(int start, int stop, int step = 1) { return Iter(begin() + clamp_(start), begin() + clamp_(stop), step); }
+        Iter<const_iterator> operator()(int start, int stop, int step = 1) const { return Iter(begin() + clamp_(start), begin() + clamp_(stop), step); }
+
+        /// push operator
+        template <typename U>
+        Deque& operator<<(U&& item) { push_back(etl::forward<U>(item)); return *this; }
+
+        /// pop operator
+        Deque& operator>>(reference item) { pop(item); return *this; }
+
+        /// construct an item in place at the back
+        /// @return 0: allocation fails, 1: success
+        template <typename... Args>
+        int emplace_back(Args&&... args) {
+            if ((head + nItems) / B >= mapLen && !grow_map_())
+                return 0;
+
+            const size_t pos = head + nItems;
+            if (!ensure_block_(pos / B))
+                return 0;
+
+            new(&at_(pos)) T(etl::forward<Args>(args)...);
+            ++nItems;
+            return 1;
+        }
+
+        /// construct an item in place at the front
+        /// @return 0: allocation fails, 1: success
+        template <typename... Args>
+        int emplace_front(Args&&... args) {
+            if (head == 0 && !grow_map_())
+                return 0;
+
+            const size_t pos = head - 1;
+            if (!ensure_block_(pos / B))
+                return 0;
+
+            new(&at_(pos)) T(etl::forward<Args>(args)...);
+            head = pos;
+            ++nItems;
+            return 1;
+        }
+
+        /// push an item at the back
+        /// @return 0: allocation fails, 1: success
+        template <typename U>
+        int push_back(U&& item) { return emplace_back(etl::forward<U>(item)); }
+
+        /// push an item at the front
+        /// @return 0: allocation fails, 1: success
+        template <typename U>
+        int push_front(U&& item) { return emplace_front(etl::forward<U>(item)); }
+
+        /// push an item at the back
+        /// @return 0: allocation fails, 1: success
+        template <typename U>
+        int push(U&& item) { return emplace_back(etl::forward<U>(item)); }
+
+        /// removes the first item
+        /// @return 0: the deque is empty, 1: success
+        int pop_front() {
+            if (nItems == 0)
+                return 0;
+
+            const size_t pos = head;
+            at_(pos).~T();
+            ++head;
+            --nItems;
+            if (nItems == 0 || head % B == 0) release_block_(pos / B);
+            return 1;
+        }
+
+        /// removes the last item
+        /// @return 0: the deque is empty, 1: success
+        int pop_back() {
+            if (nItems == 0)
+                return 0;
+
+            const size_t pos = head + nItems - 1;
+            at_(pos).~T();
+            --nItems;
+            if (nItems == 0 || pos % B == 0) release_block_(pos / B);
+            return 1;
+        }
+
+        /// removes the first item and retrieves its value
+        /// @return 0: the deque is empty, 1: success
+        int pop_front(reference item) {
+            if (nItems == 0)
+                return 0;
+            item = etl::move(front());
+            return pop_front();
+        }
+
+        /// removes the last item and retrieves its value
+        /// @return 0: the deque is empty, 1: success
+        int pop_back(reference item) {
+            if (nItems == 0)
+                return 0;
+            item = etl::move(back());
+            return pop_back();
+        }
+
+        /// removes the first item and retrieves its value
+        /// @return 0: the deque is empty, 1: success
+        int pop(reference item) { return pop_front(item); }
+
+        /// removes the first item
+        /// @return 0: the deque is empty, 1: success
+        int pop() { return pop_front(); }
+
+        /// delete all items, the map is kept
+        void clear() { while (pop_back()); }
+
+    private:
+        T& at_(size_t pos) { return map[pos / B][pos % B]; }
+        const T& at_(size_t pos) const { return map[pos / B][pos % B]; }
+
+        /// make sure the block of a slot is allocated
+        bool ensure_block_(size_t slot) {
+            if (map[slot]) return true;
+            map[slot] = spare ? etl::exchange(spare, nullptr) : A().allocate(B);
+            return map[slot] != nullptr;
+        }
+
+        /// release the block of a slot, keep it as a spare if there is none yet
+        void release_block_(size_t slot) {
+            auto block = etl::exchange(map[slot], nullptr);
+            if (spare == nullptr) spare = block;
+            else A().deallocate(block, B);
+        }
+
+        /// move the used slots to the middle of the map, the map is doubled if more than half of it is used
+        /// @note only the block pointers are moved, the items stay in place
+        bool grow_map_() {
+            const size_t first = head / B;
+            const size_t used = nItems ? (head + nItems - 1) / B - first + 1 : 0;
+
+            const size_t newLen = (used + 1) * 2 <= mapLen ? mapLen : etl::max(mapLen * 2, min_map_len);
+            const size_t newFirst = (newLen - used) / 2;
+
+            T** newMap = map;
+            if (newLen != mapLen) {
+                newMap = map_allocator().allocate(newLen);
+                if (newMap == nullptr)
+                    return false;
+                ::memset((void*)newMap, 0, newLen * sizeof(T*));
+                if (used) ::memcpy((void*)(newMap + newFirst), (const void*)(map + first), used * sizeof(T*));
+                if (map) map_allocator().deallocate(map, mapLen);
+            } else {
+                ::memmove((void*)(map + newFirst), (const void*)(map + first), used * sizeof(T*));
+                for (size_t i = 0; i < mapLen; ++i)
+                    if (i < newFirst || i >= newFirst + used) map[i] = nullptr;
+            }
+
+            map = newMap;
+            mapLen = newLen;
+            head = newFirst * B + head % B;
+            return true;
+        }
+
+        void reset_delete_() {
+            clear();
+            if (spare) A().deallocate(etl::exchange(spare, nullptr), B);
+            if (map) map_allocator().deallocate(etl::exchange(map, nullptr), mapLen);
+            mapLen = head = 0;
+        }
+
+        int clamp_(int i) const {
+            if (i < 0) i += int(nItems); // allowing negative index
+            return etl::clamp(i, 0, int(nItems));
+        }
+
+        bool is_valid_index_(int& index) const {
+            if (index < 0) index = int(nItems) + index; // allowing negative index
+            return index >= 0 && size_t(index) < nItems;
+        }
+    };
+
+    template <typename T, typename A>
+    template <typename U>
+    class Deque<T, A>::Iterator {
+        friend class Deque<T, A>;
+        T* const* map;
+        size_t pos;
+
+        Iterator(T* const* map, size_t pos) : map(map), pos(pos) {}
+
+    public:
+        /// empty constructor
+        Iterator() : map(nullptr), pos(0) {}
+
+        U& operator*() const { return map[pos / B][pos % B]; }
+        U* operator->() const { return &map[pos / B][pos % B]; }
+        U& operator[](int i) const { return map[(pos + i) / B][(pos + i) % B]; }
+
+        bool operator==(const Iterator& other) const { return pos == other.pos; }
+        bool operator!=(const Iterator& other) const { return pos != other.pos; }
+
+        Iterator& operator++() { ++pos; return *this; }
+        Iterator& operator--() { --pos; return *this; }
+        Iterator operator++(int) { return { map, pos++ }; } // NOLINT
+        Iterator operator--(int) { return { map, pos-- }; } // NOLINT
+
+        Iterator operator+(int n) const { return { map, pos + n }; }
+        Iterator operator-(int n) const { return { map, pos - n }; }
+        Iterator& operator+=(int n) { pos += n; return *this; }
+        Iterator& operator-=(int n) { pos -= n; return *this; }
+
+        size_t operator-(const Iterator& other) const { return pos - other.pos; }
+    };
+
+    /// create deque with variadic template function, the type can be explicitly specified
+    template <typename T, typename A = etl::Allocator<T>, typename... Ts> auto
+    deque(Ts&&...vals) { return Deque<T, A> { T(etl::forward<Ts>(vals))... }; }
+
+    /// type traits
+    template <typename T> struct is_deque : false_type {};
+    template <typename T, typename A> struct is_deque<Deque<T, A>> : true_type {};
+    template <typename T, typename A> struct is_deque<const Deque<T, A>> : true_type {};
+    template <typename T, typename A> struct is_deque<volatile Deque<T, A>> : true_type {};
+    template <typename T, typename A> struct is_deque<const volatile Deque<T, A>> : true_type {};
+    template <typename T> inline constexpr bool is_deque_v = is_deque<T>::value;
+
+    /// the items live in separately allocated blocks, moving the deque only moves the pointers
+    template <typename T, typename A> struct is_trivially_relocatable<Deque<T, A>> : true_type {};
+
+    template <typename T, typename A> struct remove_extent<Deque<T, A>> { typedef T type; };
+    template <typename T, typename A> struct remove_extent<const Deque<T, A>> { typedef T type; };
+    template <typename T, typename A> struct remove_extent<volatile Deque<T, A>> { typedef T type; };
+    template <typename T, typename A> struct remove_extent<const volatile Deque<T, A>> { typedef T type; };
+}
+
+#endif //ETL_DEQUE_H
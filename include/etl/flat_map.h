@@ -0,0 +1,204 @@
+#ifndef ETL_FLAT_MAP_H
+#define ETL_FLAT_MAP_H
+
+#include "etl/vector.h"
+
+namespace Project::etl {
+
+    /// collection of key-value pairs sorted by key, keys are unique.
+    /// lookups are O(log n) binary searches over contiguous storage, suited for read-mostly maps
+    /// @note the key type must be comparable with operator<
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>>
+    class FlatMap : public Vector<Pair<K, V>, A> {
+        typedef Vector<Pair<K, V>, A> Base;
+
+        // adding items through the vector interface would break the ordering
+        using Base::append;
+        using Base::emplace_back;
+        using Base::fill;
+        using Base::operator+;
+        using Base::operator+=;
+
+    public:
+        typedef K Key;
+        typedef V Value;
+        typedef typename Base::iterator iterator;
+        typedef typename Base::const_iterator const_iterator;
+
+        /// empty constructor
+        constexpr FlatMap() : Base() {}
+
+        /// construct and set the capacity
+        explicit FlatMap(size_t capacity) : Base(capacity) {}
+
+        /// construct from initializer list, the items don't need to be sorted
+        FlatMap(std::initializer_list<Pair<K, V>>&& items) : Base() { insert_bulk(items); }
+
+        /// check if a key is in this map
+        bool has(const K& key) const { return static_cast<bool>(find(key)); }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        V& get(const K& key) { return *find(key); }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        const V& get(const K& key) const { return *find(key); }
+
+        /// get a value given the key. if the key does not exist, insert new pair and return default constructed V
+        template <typename KK>
+        V& operator[](KK&& key) {
+            if constexpr (!etl::is_same_v<etl::decay_t<KK>, K>) {
+                return operator[](K(etl::forward<KK>(key)));
+            } else {
+                auto it = lower_bound(key);
+                if (it != this->end() && !(key < it->x)) return it->y;
+
+                auto item = insert_at_(it - this->begin(), etl::forward<KK>(key), Value{});
+                return item ? item->y : *static_cast<V*>(nullptr);
+            }
+        }
+
+        /// get a value given the key. if the key does not exist, return default constructed V
+        const V& operator[](const K& key) const {
+            auto res = find(key);
+            if (res) return *res;
+            static const auto v = Value{};
+            return v;
+        }
+
+        /// insert a key-value pair if the key does not exist
+        /// @return true if the pair is inserted
+        template <typename KK, typename VV>
+        bool insert(KK&& key, VV&& value) {
+            if constexpr (!etl::is_same_v<etl::decay_t<KK>, K>) {
+                return insert(K(etl::forward<KK>(key)), etl::forward<VV>(value));
+            } else {
+                auto it = lower_bound(key);
+                if (it != this->end() && !(key < it->x)) return false;
+                return insert_at_(it - this->begin(), etl::forward<KK>(key), etl::forward<VV>(value)) != nullptr;
+            }
+        }
+
+        /// insert all pairs of a sequence whose keys do not exist yet, the sequence doesn't need to be sorted.
+        /// the pairs are appended, then the whole storage is sorted and deduplicated once
+        /// @return number of inserted pairs
+        /// @note if the sequence contains a key more than once, it is unspecified which of the pairs is kept
+        template <typename Sequence>
+        size_t insert_bulk(Sequence&& seq) {
+            const size_t n = this->len();
+
+            if constexpr (etl::trait_len<etl::decay_t<Sequence>>::value) {
+                auto newCapacity = n + etl::len(seq);
+                if (this->size() < newCapacity && !this->reserve(newCapacity))
+                    return 0;
+            }
+
+            for (auto&& item : seq) {
+                auto first = this->begin();
+                if (etl::binary_search(first, first + n, item, KeyLess{})) continue;
+
+                if constexpr (etl::is_lvalue_reference_v<Sequence>) append(item);
+                else append(etl::move(item));
+            }
+            if (this->len() == n) 
+                return 0;
+
+            etl::sort(this->begin(), this->end(), KeyLess{});
+            auto last = etl::unique(this->begin(), this->end(), [](const Pair<K, V>& a, const Pair<K, V>& b) { return !(a.x < b.x); });
+            this->resize(last - this->begin());
+            return this->len() - n;
+        }
+
+        /// remove key-value pair given the key
+        bool remove(const K& key) {
+            auto it = lower_bound(key);
+            if (it == this->end() || key < it->x) return false;
+            return this->remove_at(it - this->begin());
+        }
+
+        V* find(const K& key) {
+            auto it = lower_bound(key);
+            return it != this->end() && !(key < it->x) ? &it->y : nullptr;
+        }
+
+        const V* find(const K& key) const {
+            auto it = lower_bound(key);
+            return it != this->end() && !(key < it->x) ? &it->y : nullptr;
+        }
+
+        /// pointer to the first pair whose key is not less than the given key
+        iterator lower_bound(const K& key) { return etl::lower_bound(this->begin(), this->end(), key, KeyLess{}); }
+        const_iterator lower_bound(const K& key) const { return etl::lower_bound(this->begin(), this->end(), key, KeyLess{}); }
+
+        /// pointer to the first pair whose key is greater than the given key
+        iterator upper_bound(const K& key) { return etl::upper_bound(this->begin(), this->end(), key, KeyLess{}); }
+        const_iterator upper_bound(const K& key) const { return etl::upper_bound(this->begin(), this->end(), key, KeyLess{}); }
+
+        /// iter object of the pairs whose keys are in [lo, hi)
+        Iter<iterator> range(const K& lo, const K& hi) {
+            auto first = lower_bound(lo);
+            return Iter(first, etl::max(first, lower_bound(hi)), 1);
+        }
+
+        /// iter object of the pairs whose keys are in [lo, hi)
+        Iter<const_iterator> range(const K& lo, const K& hi) const {
+            auto first = lower_bound(lo);
+            return Iter(first, etl::max(first, lower_bound(hi)), 1);
+        }
+
+    private:
+        /// compares pairs and keys by key
+        struct KeyLess {
+            static constexpr const K& key(const Pair<K, V>& pair) { return pair.x; }
+            static constexpr const K& key(const K& key) { return key; }
+            template <typename T, typename U> constexpr bool operator()(const T& a, const U& b) const { return key(a) < key(b); }
+        };
+
+        template <typename KK, typename VV>
+        Pair<K, V>* insert_at_(size_t index, KK&& key, VV&& value) {
+            auto n = this->len();
+            Base::insert(int(index), Pair<K, V>{K(etl::forward<KK>(key)), V(etl::forward<VV>(value))});
+            return this->len() > n ? this->begin() + index : nullptr;
+        }
+    };
+
+    /// create flat map using variadic function, type is implicitly specified
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>, typename... Ks, typename... Vs,
+        typename = enable_if_t<(is_same_v<K, Ks> && ...) && (is_same_v<V, Vs> && ...)>> auto
+    flat_map(const Pair<K, V>& item, const Pair<Ks, Vs>&... items) { return FlatMap<K, V, A> { item, items... }; }
+
+    /// create flat map using variadic function, type is implicitly specified
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>, typename... Ks, typename... Vs,
+        typename = enable_if_t<(is_same_v<K, Ks> && ...) && (is_same_v<V, Vs> && ...)>> auto
+    flat_map(Pair<K, V>&& item, Pair<Ks, Vs>&&... items) { return FlatMap<K, V, A> { etl::move(item), etl::move(items)... }; }
+
+    /// create flat map from initializer list, type is explicitly specified
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> auto
+    flat_map(std::initializer_list<Pair<K,V>>&& items) { return FlatMap<K, V, A>(etl::move(items)); }
+
+    /// create empty flat map, capacity is 0
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> constexpr auto
+    flat_map() { return FlatMap<K, V, A> {}; }
+
+    /// create empty flat map, and set the capacity
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> auto
+    flat_map_reserve(size_t capacity) { return FlatMap<K, V, A>(capacity); }
+
+    /// type traits
+    template <typename T> struct is_flat_map : false_type {};
+    template <typename K, typename V, typename A> struct is_flat_map<FlatMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_flat_map<const FlatMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_flat_map<volatile FlatMap<K, V, A>> : true_type {};
+    template <typename K, typename V, typename A> struct is_flat_map<const volatile FlatMap<K, V, A>> : true_type {};
+    template <typename T> inline constexpr bool is_flat_map_v = is_flat_map<T>::value;
+
+    template <typename K, typename V, typename A> struct is_trivially_relocatable<FlatMap<K, V, A>> : true_type {};
+
+    template <typename K, typename V, typename A> struct remove_extent<FlatMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<const FlatMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<volatile FlatMap<K, V, A>> { typedef Pair<K, V> type; };
+    template <typename K, typename V, typename A> struct remove_extent<const volatile FlatMap<K, V, A>> { typedef Pair<K, V> type; };
+}
+
+#endif //ETL_FLAT_MAP_H
@@ -0,0 +1,86 @@
+#ifndef ETL_HASH_H
+#define ETL_HASH_H
+
+#include "etl/tuple.h"
+#include <cstring> // memcpy
+
+namespace Project::etl::detail {
+    /// finalizer of murmur3, spreads the entropy of every input bit to every output bit
+    constexpr uint64_t hash_mix(uint64_t x) {
+        x ^= x >> 33u;
+        x *= 0xff51'afd7'ed55'8ccdull;
+        x ^= x >> 33u;
+        x *= 0xc4ce'b9fe'1a85'ec53ull;
+        x ^= x >> 33u;
+        return x;
+    }
+
+    /// FNV-1a over a character sequence, followed by the mixer
+    constexpr uint64_t hash_bytes(const char* str, size_t length) {
+        uint64_t res = 0xcbf2'9ce4'8422'2325ull;
+        for (size_t i = 0; i < length; ++i) {
+            res ^= uint8_t(str[i]);
+            res *= 0x0000'0100'0000'01b3ull;
+        }
+        return hash_mix(res ^ length);
+    }
+
+    template <typename T, typename = void> struct trait_has_data_len : etl::false_type {};
+    template <typename T> struct trait_has_data_len<T, etl::void_t<decltype(etl::declval<T>().data()), decltype(etl::declval<T>().len())>> 
+        : etl::bool_constant<etl::is_same_v<etl::decay_t<decltype(*etl::declval<T>().data())>, char>> {};
+}
+
+namespace Project::etl {
+    /// compute the hash value of an object
+    template <typename T> constexpr size_t
+    hash(const T& value) { return etl::trait_hash<etl::decay_t<T>>::hash(value); }
+
+    /// combine a hash value with the hash value of another object
+    template <typename T> constexpr size_t
+    hash_combine(size_t seed, const T& value) { return size_t(detail::hash_mix(seed ^ (etl::hash(value) + 0x9e37'79b9'7f4a'7c15ull))); }
+}
+
+/// trait hash default specializations
+namespace Project::etl {
+    template <typename T> struct trait_hash<T, etl::enable_if_t<etl::is_integral_v<T>>> : etl::true_type {
+        static constexpr size_t hash(T value) { return size_t(detail::hash_mix(uint64_t(value))); }
+    };
+
+    /// hash of the underlying integer
+    template <typename T> struct trait_hash<T, etl::enable_if_t<etl::is_enum_v<T>>> : etl::true_type {
+        static constexpr size_t hash(T value) { return etl::hash(etl::underlying_type_t<T>(value)); }
+    };
+
+    /// hash of the bits of the value as double, -0.0 hashes the same as 0.0 since they compare equal
+    template <typename T> struct trait_hash<T, etl::enable_if_t<etl::is_floating_point_v<T>>> : etl::true_type {
+        static size_t hash(T value) {
+            const double x = value == T(0) ? 0.0 : double(value);
+            uint64_t bits;
+            ::memcpy(&bits, &x, sizeof(bits));
+            return size_t(detail::hash_mix(bits));
+        }
+    };
+
+    template <typename T> struct trait_hash<T*, etl::enable_if_t<!etl::is_same_v<etl::remove_const_t<T>, char>>> : etl::true_type {
+        static size_t hash(const T* value) { return size_t(detail::hash_mix(uint64_t(reinterpret_cast<uintptr_t>(value)))); }
+    };
+
+    template <typename T> struct trait_hash<T, etl::enable_if_t<etl::is_same_v<T, const char*> || etl::is_same_v<T, char*>>> : etl::true_type {
+        static constexpr size_t hash(const char* value) {
+            size_t length = 0;
+            if (value) while (value[length] != '\0') ++length;
+            return size_t(detail::hash_bytes(value, length));
+        }
+    };
+
+    /// any contiguous character sequence, e.g. StringView and String<N>
+    template <typename T> struct trait_hash<T, etl::enable_if_t<detail::trait_has_data_len<const T&>::value>> : etl::true_type {
+        static constexpr size_t hash(const T& value) { return size_t(detail::hash_bytes(value.data(), value.len())); }
+    };
+
+    template <typename X, typename Y> struct trait_hash<Pair<X, Y>> : etl::true_type {
+        static constexpr size_t hash(const Pair<X, Y>& value) { return etl::hash_combine(etl::hash(value.x), value.y); }
+    };
+}
+
+#endif // ETL_HASH_H
@@ -0,0 +1,342 @@
+#ifndef ETL_INTRUSIVE_LIST_H
+#define ETL_INTRUSIVE_LIST_H
+
+#include "etl/iter.h"
+#include "etl/utility_basic.h"
+
+namespace Project::etl {
+
+    /// link hook to be embedded in the objects of an intrusive list
+    /// @note copying an object does not copy its links
+    class IntrusiveListHook {
+        template <typename T, IntrusiveListHook T::*Hook>
+        friend class IntrusiveList;
+
+        IntrusiveListHook* next = nullptr;
+        IntrusiveListHook* prev = nullptr;
+
+    public:
+        constexpr IntrusiveListHook() {}
+        constexpr IntrusiveListHook(const IntrusiveListHook&) {}
+        constexpr IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+        /// return true if this hook is currently inserted in a list
+        bool is_linked() const { return next != nullptr; }
+    };
+
+    /// doubly linked list where the links live inside the items themselves, no allocation is performed
+    /// @tparam T item type
+    /// @tparam Hook pointer to the IntrusiveListHook member of T
+    /// @note the list does not own the items, an item must outlive its membership in the list
+    template <typename T, IntrusiveListHook T::*Hook>
+    class IntrusiveList {
+    public:
+        template <typename U>
+        class Iterator;
+
+        typedef T value_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef Iterator<T> iterator;
+        typedef Iterator<const T> const_iterator;
+
+        /// empty constructor
+        IntrusiveList() { root.next = root.prev = &root; }
+
+        /// variadic template function constructor
+        template <typename ...Us>
+        explicit IntrusiveList(T& item, Us&... items) : IntrusiveList() {
+            push(item);
+            ((push(items)), ...);
+        }
+
+        /// items can only be linked to one list at a time
+        IntrusiveList(const IntrusiveList&) = delete;
+        IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+        /// move constructor
+        IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() { take_(other); }
+
+        /// move assignment
+        IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+            if (this == &other) return *this;
+            clear();
+            take_(other);
+            return *this;
+        }
+
+        /// unlink all items
+        ~IntrusiveList() { clear(); }
+
+        iterator begin() { return iterator(root.next); }
+        iterator end()   { return iterator(&root); }
+        iterator tail()  { return iterator(root.prev); }
+
+        const_iterator begin() const { return const_iterator(root.next); }
+        const_iterator end()   const { return const_iterator(&root); }
+        const_iterator tail()  const { return const_iterator(root.prev); }
+
+        /// @retval number of items
+        size_t len() const { return nItems; }
+
+        /// unlink all items
+        void clear() {
+            for (auto p = root.next; p != &root;) {
+                auto nx = p->next;
+                p->next = p->prev = nullptr;
+                p = nx;
+            }
+            root.next = root.prev = &root;
+            nItems = 0;
+        }
+
+        /// get the first item
+        /// @warning make sure the list is not empty
+        reference front() { return *begin(); }
+        const_reference front() const { return *begin(); }
+
+        /// get the last item
+        /// @warning make sure the list is not empty
+        reference back() { return *tail(); }
+        const_reference back() const { return *tail(); }
+
+        /// get i-th item by dereference, negative index is allowed
+        /// @warning the return reference might be null
+        reference operator[](int i) {
+            auto p = at_(i);
+            return p == &root ? *static_cast<T*>(nullptr) : owner_(p);
+        }
+
+        /// get i-th item by dereference, negative index is allowed
+        /// @warning the return reference might be null
+        const_reference operator[](int i) const {
+            auto p = at_(i);
+            return p == &root ? *static_cast<const T*>(nullptr) : owner_(p);
+        }
+
+        explicit operator bool() const { return nItems > 0; }
+
+        /// slice operator, the indexes are clamped to the items and the slice is empty if start is at the end
+        Iter<iterator> operator()(int start, int stop, int step = 1) {
+            auto first = clamp_(start);
+            return Iter(iterator(first), iterator(first == &root ? first : clamp_(stop)), step);
+        }
+
+        /// slice operator, the indexes are clamped to the items and the slice is empty if start is at the end
+        Iter<const_iterator> operator()(int start, int stop, int step = 1) const {
+            auto first = clamp_(start);
+            return Iter(const_iterator(first), const_iterator(first == &root ? first : clamp_(stop)), step);
+        }
+
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        Iter<iterator> reversed() { return Iter(tail(), end(), -1); }
+
+        Iter<const_iterator> reversed() const { return Iter(tail(), end(), -1); }
+
+        /// push operator
+        IntrusiveList& operator<<(reference item) { push(item); return *this; }
+
+        /// link an item at the back of the list
+        /// @return 0: the item is already linked, 1: success
+        int push(reference item) { return link_(&(item.*Hook), &root); }
+
+        /// link an item at a specific position
+        /// @return 0: the item is already linked or pos is out of range, 1: success
+        int push(reference item, size_t pos) {
+            if (pos > nItems)
+                return 0;
+            return link_(&(item.*Hook), pos == nItems ? &root : at_(int(pos)));
+        }
+
+        /// link an item at the back
+        int push_back(reference item) { return push(item); }
+
+        /// link an item at the front
+        int push_front(reference item) { return link_(&(item.*Hook), root.next); }
+
+        /// link an item right before another item of this list
+        /// @warning pos has to be linked to this list
+        int insert_before(reference pos, reference item) { return link_(&(item.*Hook), &(pos.*Hook)); }
+
+        /// link an item right after another item of this list
+        /// @warning pos has to be linked to this list
+        int insert_after(reference pos, reference item) { return link_(&(item.*Hook), (pos.*Hook).next); }
+
+        /// unlink an item from anywhere in this list in constant time
+        /// @return 0: the item is not linked, 1: success
+        /// @warning the item has to be linked to this list, not another one
+        int remove(reference item) { return unlink_(&(item.*Hook)); }
+
+        /// unlink the first item
+        /// @retval pointer to the unlinked item, null if the list is empty
+        T* pop() { return pop_front(); }
+
+        /// unlink the first item
+        /// @retval pointer to the unlinked item, null if the list is empty
+        T* pop_front() { return pop_(root.next); }
+
+        /// unlink the last item
+        /// @retval pointer to the unlinked item, null if the list is empty
+        T* pop_back() { return pop_(root.prev); }
+
+    private:
+        IntrusiveListHook root; ///< sentinel, root.next is the head and root.prev is the tail
+        size_t nItems = 0;
+
+        /// byte offset of the hook inside T
+        static size_t hook_offset_() {
+            alignas(T) unsigned char storage[sizeof(T)]; // real storage for the address arithmetic, no T is constructed
+            auto base = reinterpret_cast<T*>(storage);
+            return reinterpret_cast<uintptr_t>(&(base->*Hook)) - reinterpret_cast<uintptr_t>(base);
+        }
+
+        static T& owner_(IntrusiveListHook* hook) {
+            return *reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hook_offset_());
+        }
+
+        static const T& owner_(const IntrusiveListHook* hook) {
+            return *reinterpret_cast<const T*>(reinterpret_cast<const char*>(hook) - hook_offset_());
+        }
+
+        /// hook at an index clamped to [0, len], the root if it is len
+        IntrusiveListHook* clamp_(int i) const {
+            if (i < 0) i += int(nItems); // allowing negative index
+            return at_(i < 0 ? 0 : i > int(nItems) ? int(nItems) : i);
+        }
+
+        /// hook at a specific position, walking from the nearest end
+        /// @retval the root if the index is out of range
+        IntrusiveListHook* at_(int i) const {
+            auto r = const_cast<IntrusiveListHook*>(&root);
+            if (i < 0) i += int(nItems); // allowing negative index
+            if (i < 0 || size_t(i) >= nItems)
+                return r;
+
+            auto p = r;
+            if (size_t(i) < nItems / 2)
+                for (int k = 0; k <= i; ++k) p = p->next;
+            else
+                for (size_t k = nItems - i; k > 0; --k) p = p->prev;
+            return p;
+        }
+
+        /// link a hook right before another hook
+        int link_(IntrusiveListHook* hook, IntrusiveListHook* nx) {
+            if (hook->is_linked())
+                return 0;
+
+            hook->next = nx;
+            hook->prev = nx->prev;
+            nx->prev->next = hook;
+            nx->prev = hook;
+            ++nItems;
+            return 1;
+        }
+
+        int unlink_(IntrusiveListHook* hook) {
+            if (hook == &root || !hook->is_linked())
+                return 0;
+
+            hook->prev->next = hook->next;
+            hook->next->prev = hook->prev;
+            hook->next = hook->prev = nullptr;
+            --nItems;
+            return 1;
+        }
+
+        T* pop_(IntrusiveListHook* hook) {
+            if (!unlink_(hook))
+                return nullptr;
+            return &owner_(hook);
+        }
+
+        /// take over the items of other list, the head and the tail have to be repointed to this root
+        void take_(IntrusiveList& other) {
+            if (!other.nItems)
+                return;
+
+            root.next = other.root.next;
+            root.prev = other.root.prev;
+            root.next->prev = root.prev->next = &root;
+            nItems = etl::exchange(other.nItems, 0);
+            other.root.next = other.root.prev = &other.root;
+        }
+    };
+
+    template <typename T, IntrusiveListHook T::*Hook>
+    template <typename U>
+    class IntrusiveList<T, Hook>::Iterator {
+        friend class IntrusiveList<T, Hook>;
+        IntrusiveListHook* node;
+
+        /// construct from hook pointer
+        explicit Iterator(const IntrusiveListHook* node) : node(const_cast<IntrusiveListHook*>(node)) {}
+
+    public:
+        /// empty constructor
+        Iterator() : node(nullptr) {}
+
+        /// convert mutable iterator to const iterator
+        template <typename V, typename = etl::enable_if_t<etl::is_const_v<U> && !etl::is_const_v<V>>>
+        Iterator(const Iterator<V>& other) : node(other.node) {} // NOLINT
+
+        /// dereference operator
+        /// @warning make sure the iterator is not the end
+        U& operator*() const { return owner_(node); }
+
+        /// arrow operator to access the item's member
+        U* operator->() const { return &owner_(node); }
+
+        template <typename V>
+        bool operator==(const Iterator<V>& other) const { return node == other.node; }
+
+        template <typename V>
+        bool operator!=(const Iterator<V>& other) const { return node != other.node; }
+
+        Iterator& operator++() { node = node->next; return *this; }
+        Iterator& operator--() { node = node->prev; return *this; }
+
+        Iterator operator++(int) { // NOLINT
+            Iterator res = *this;
+            node = node->next;
+            return res;
+        }
+
+        Iterator operator--(int) { // NOLINT
+            Iterator res = *this;
+            node = node->prev;
+            return res;
+        }
+
+        /// number of steps from other iterator to this iterator
+        template <typename V>
+        size_t operator-(const Iterator<V>& other) const {
+            size_t i = 0;
+            for (auto p = node; p != other.node; p = p->prev, ++i)
+                if (i > 0 && p == node) return 0; // other is not reachable
+            return i;
+        }
+
+    private:
+        template <typename V>
+        friend class Iterator;
+    };
+
+    /// type traits
+    template <typename T> struct is_intrusive_list : false_type {};
+    template <typename T, IntrusiveListHook T::*H> struct is_intrusive_list<IntrusiveList<T, H>> : true_type {};
+    template <typename T, IntrusiveListHook T::*H> struct is_intrusive_list<const IntrusiveList<T, H>> : true_type {};
+    template <typename T, IntrusiveListHook T::*H> struct is_intrusive_list<volatile IntrusiveList<T, H>> : true_type {};
+    template <typename T, IntrusiveListHook T::*H> struct is_intrusive_list<const volatile IntrusiveList<T, H>> : true_type {};
+    template <typename T> inline constexpr bool is_intrusive_list_v = is_intrusive_list<T>::value;
+
+    template <typename T, IntrusiveListHook T::*H> struct remove_extent<IntrusiveList<T, H>> { typedef T type; };
+    template <typename T, IntrusiveListHook T::*H> struct remove_extent<const IntrusiveList<T, H>> { typedef T type; };
+    template <typename T, IntrusiveListHook T::*H> struct remove_extent<volatile IntrusiveList<T, H>> { typedef T type; };
+    template <typename T, IntrusiveListHook T::*H> struct remove_extent<const volatile IntrusiveList<T, H>> { typedef T type; };
+}
+
+#endif //ETL_INTRUSIVE_LIST_H
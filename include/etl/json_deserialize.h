@@ -65,8 +65,11 @@ namespace Project::etl::json {
                 return etl::Err("JSON is not a basic type");
             }
         }
-        else if constexpr (etl::is_vector_v<T>) {
+        else if constexpr (etl::is_vector_v<T> || etl::is_small_vector_v<T> || etl::is_static_vector_v<T>) {
             if (!js.is_list()) return etl::Err("JSON is not a list");
+            if constexpr (etl::is_static_vector_v<T>) {
+                if (js.len() > T::size()) return etl::Err("JSON list exceeds the capacity");
+            }
             for (auto item : js) {
                 deserialize<typename T::value_type>(item).then([&res] (typename T::value_type it) {
                     res.append(etl::move(it));
@@ -91,7 +94,7 @@ namespace Project::etl::json {
                 });
             }
         }
-        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || detail::is_std_map_v<T> || detail::is_std_unordered_map_v<T>) {
+        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || etl::is_flat_map_v<T> || etl::is_btree_map_v<T> || detail::is_std_map_v<T> || detail::is_std_unordered_map_v<T>) {
             if (!js.is_dictionary()) return etl::Err("JSON is not a map");
             for (auto [key, value] : js) {
                 deserialize<typename detail::json_map<T>::value>(value).then([&] (typename detail::json_map<T>::value it) {
@@ -97,7 +97,7 @@ namespace Project::etl::json {
                 return res;
             }
         }
-        else if constexpr (etl::is_linked_list_v<T> || etl::is_vector_v<T> || etl::is_array_v<T> || 
+        else if constexpr (etl::is_linked_list_v<T> || etl::is_vector_v<T> || etl::is_small_vector_v<T> || etl::is_static_vector_v<T> || etl::is_array_v<T> || 
             detail::is_std_list_v<T> || detail::is_std_vector_v<T> || detail::is_std_array_v<T>
         ) {
             const size_t n = size_max(value); 
@@ -124,7 +124,7 @@ namespace Project::etl::json {
                 return res;
             }
         }
-        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || 
+        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || etl::is_flat_map_v<T> || etl::is_btree_map_v<T> ||
             detail::is_std_map_v<T> || detail::is_std_unordered_map_v<T>
         ) {
             const size_t n = size_max(value); 
@@ -149,7 +149,12 @@ namespace Project::etl::json {
                 return res;
             }
         }
-        else if constexpr (detail::is_variant_v<T>) {
+        else if constexpr (etl::is_variant_v<T>) {
+            return etl::visit([&](const auto& item) -> R {
+                return serialize<etl::decay_t<decltype(item)>, R>(item);
+            }, value);
+        }
+        else if constexpr (detail::is_std_variant_v<T>) {
             return std::visit([&](const auto& item) -> R {
                 return serialize<etl::decay_t<decltype(item)>, R>(item);
             }, value);
@@ -48,7 +48,7 @@ namespace Project::etl::json {
         else if constexpr (etl::is_etl_string_v<T> || etl::is_same_v<T, etl::StringView>) {
             return value.len() + 2;
         }
-        else if constexpr (etl::is_linked_list_v<T> || etl::is_vector_v<T> || etl::is_array_v<T> || 
+        else if constexpr (etl::is_linked_list_v<T> || etl::is_vector_v<T> || etl::is_small_vector_v<T> || etl::is_static_vector_v<T> || etl::is_array_v<T> || 
             detail::is_std_list_v<T> || detail::is_std_vector_v<T> || detail::is_std_array_v<T>
         ) {
             size_t cnt = 1;
@@ -59,7 +59,7 @@ namespace Project::etl::json {
             }
             return cnt + is_empty;
         }
-        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || 
+        else if constexpr (etl::is_map_v<T> || etl::is_unordered_map_v<T> || etl::is_flat_map_v<T> || etl::is_btree_map_v<T> ||
             detail::is_std_map_v<T> || detail::is_std_unordered_map_v<T>
         ) {
             size_t cnt = 1;
@@ -70,7 +70,12 @@ namespace Project::etl::json {
             }
             return cnt + is_empty;
         }
-        else if constexpr (detail::is_variant_v<T>) {
+        else if constexpr (etl::is_variant_v<T>) {
+            return etl::visit([&](const auto& item) -> size_t {
+                return size_max(item);
+            }, value);
+        }
+        else if constexpr (detail::is_std_variant_v<T>) {
             return std::visit([&](const auto& item) -> size_t {
                 return size_max(item);
             }, value);
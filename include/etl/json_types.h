@@ -5,10 +5,15 @@
 #include "etl/optional.h"
 #include "etl/array.h"
 #include "etl/vector.h"
+#include "etl/small_vector.h"
+#include "etl/static_vector.h"
 #include "etl/linked_list.h"
 #include "etl/map.h"
+#include "etl/flat_map.h"
+#include "etl/btree_map.h"
 #include "etl/unordered_map.h"
 #include "etl/ref.h"
+#include "etl/variant.h"
 #include <string>
 #include <optional>
 #include <array>
@@ -24,14 +29,14 @@
 namespace Project::etl::json {
     #define JSON_BASIC_TYPES std::nullptr_t, bool, int, double, etl::StringView, std::string
 
-    using BasicType = std::variant<JSON_BASIC_TYPES>;
+    using BasicType = etl::Variant<JSON_BASIC_TYPES>;
 
     template<typename ...Ts>
-    using List_ = etl::LinkedList<std::variant<JSON_BASIC_TYPES, Ts...>>;
+    using List_ = etl::LinkedList<etl::Variant<JSON_BASIC_TYPES, Ts...>>;
     using List = List_<>;
 
     template<typename ...Ts>
-    using Map_ = etl::UnorderedMap<etl::StringView, std::variant<JSON_BASIC_TYPES, Ts...>>;
+    using Map_ = etl::UnorderedMap<etl::StringView, etl::Variant<JSON_BASIC_TYPES, Ts...>>;
     using Map = Map_<>;
 
     #undef JSON_BASIC_TYPES
@@ -62,13 +67,15 @@ namespace Project::etl::detail {
     template <typename T> struct is_std_optional<std::optional<T>> : true_type {};
     template <typename T> inline constexpr bool is_std_optional_v = is_std_optional<T>::value;
 
-    template <typename T> struct is_variant : false_type {};
-    template <typename... T> struct is_variant<std::variant<T...>> : true_type {};
-    template <typename T> inline constexpr bool is_variant_v = is_variant<T>::value;
+    template <typename T> struct is_std_variant : false_type {};
+    template <typename... T> struct is_std_variant<std::variant<T...>> : true_type {};
+    template <typename T> inline constexpr bool is_std_variant_v = is_std_variant<T>::value;
 
     template <typename T> struct json_map;
     template <typename K, typename V> struct json_map<etl::Map<K, V>> { typedef K key; typedef V value; };
     template <typename K, typename V> struct json_map<etl::UnorderedMap<K, V>> { typedef K key; typedef V value; };
+    template <typename K, typename V> struct json_map<etl::FlatMap<K, V>> { typedef K key; typedef V value; };
+    template <typename K, typename V> struct json_map<etl::BTreeMap<K, V>> { typedef K key; typedef V value; };
     template <typename K, typename V> struct json_map<std::map<K, V>> { typedef K key; typedef V value; };
     template <typename K, typename V> struct json_map<std::unordered_map<K, V>> { typedef K key; typedef V value; };
 }
@@ -3,14 +3,16 @@
 
 #include "etl/allocator.h"
 #include "etl/algorithm.h"
+#include <new>
 
 namespace Project::etl {
 
-    /// doubly linked list. every item will be allocated to heap
+    /// doubly linked list. every item is stored inline in a node allocated to heap
     template <typename T, typename A = etl::Allocator<T>>
     // template <typename T>
     class LinkedList {
         struct Node; ///< contains the item and pointer to next and prev items
+        typedef etl::allocator_rebind_t<A, Node> node_allocator;
 
     public:
         template <typename U>
@@ -43,7 +45,10 @@ namespace Project::etl {
         }
 
         /// move constructor
-        LinkedList(LinkedList&& l) noexcept : head(etl::exchange(l.head, iterator())) {}
+        LinkedList(LinkedList&& l) noexcept 
+            : head(etl::exchange(l.head, iterator()))
+            , last(etl::exchange(l.last, iterator()))
+            , nItems(etl::exchange(l.nItems, 0)) {}
 
         /// copy assignment
         LinkedList& operator=(const LinkedList& other) {
@@ -56,6 +61,8 @@ namespace Project::etl {
         LinkedList& operator=(LinkedList&& other) noexcept {
             clear();
             head = etl::exchange(other.head, iterator());
+            last = etl::exchange(other.last, iterator());
+            nItems = etl::exchange(other.nItems, 0);
             return *this;
         }
 
@@ -64,19 +71,15 @@ namespace Project::etl {
         iterator data()  { return head; }
         iterator begin() { return head; }
         iterator end()   { return iterator(); }
-        iterator tail()  { return head + (len() - 1); }
+        iterator tail()  { return last; }
 
         const_iterator data()  const { return const_iterator(head); }
         const_iterator begin() const { return const_iterator(head); }
         const_iterator end()   const { return const_iterator(); }
-        const_iterator tail()  const { return const_iterator(head) + (len() - 1); }
+        const_iterator tail()  const { return const_iterator(last); }
 
         /// @retval number of items
-        size_t len() const {
-            size_t res = 0;
-            for (auto& _ [[maybe_unused]] : *this) res++;
-            return res;
-        }
+        size_t len() const { return nItems; }
 
         /// delete all items
         void clear() const { while (pop()); }
@@ -142,41 +145,51 @@ namespace Project::etl {
         /// pop operator
         const LinkedList& operator>>(reference item) const { pop(item); return *this; }
 
-        /// push an item at the back of the list
-        template <typename U>
-        int push(U&& item) const {
-            auto node = make_iterator(etl::forward<U>(item)); // create new node
-            if (!node) 
-                return 0; 
-
-            if (!head) { 
-                head = node; // if the linked list is empty, set the head to the new node
-                return 1;
-            }
-
-            return tail().insert(const_iterator(node)); // insert the node at the back
-        }
+        /// construct an item in place at a specific position of the list
+        /// @param pos position of the new item, must not be greater than len()
+        /// @param args arguments forwarded to the constructor of T
+        /// @return 0: fail, 1: success
+        template <typename... Args>
+        int emplace(size_t pos, Args&&... args) const {
+            if (pos > nItems)
+                return 0;
 
-        /// push an item to the list at a specific position
-        template <typename U>
-        int push(U&& item, size_t pos) const {
-            auto node = make_iterator(etl::forward<U>(item)); // create new node
+            auto node = make_iterator(etl::forward<Args>(args)...); // create new node
             if (!node) 
                 return 0;
 
-            if (pos == 0) {
+            if (!head) {
+                head = last = node; // if the linked list is empty, set the head and the tail to the new node
+            } else if (pos == nItems) {
+                last.insert(node); // insert the node at the back
+                last = node;
+            } else if (pos == 0) {
                 head.insert_prev(node);  // if pos is 0, insert the new node at the beginning
                 head = node;
-                return 1;
+            } else {
+                (head + (pos - 1)).insert(node); // find the node at the desired position and insert the new node after it
             }
 
-            int res = (head + (pos - 1)).insert(node); // find the node at the desired position and insert the new node after it
-            if (res == 0) 
-                node.erase(); // erase the new node if insertion failed
-
-            return res;
+            ++nItems;
+            return 1;
         }
 
+        /// construct an item in place at the back
+        template <typename... Args>
+        int emplace_back(Args&&... args) const { return emplace(nItems, etl::forward<Args>(args)...); }
+
+        /// construct an item in place at the front
+        template <typename... Args>
+        int emplace_front(Args&&... args) const { return emplace(0, etl::forward<Args>(args)...); }
+
+        /// push an item at the back of the list
+        template <typename U>
+        int push(U&& item) const { return emplace(nItems, etl::forward<U>(item)); }
+
+        /// push an item to the list at a specific position
+        template <typename U>
+        int push(U&& item, size_t pos) const { return emplace(pos, etl::forward<U>(item)); }
+
         /// push an item at the back
         template <typename U>
         int push_back(U&& item)  const { return push(etl::forward<U>(item)); }
@@ -187,24 +200,16 @@ namespace Project::etl {
 
         /// removes an item from the list at a specific position and retrieves its value
         int pop_at(reference item, size_t pos) const {
-            auto node = head + pos;
-            if (node) 
-                item = etl::move(*node);
-            
-            if (pos == 0 && head) 
-                head = head.next();
-            
-            return node.erase();
+            auto node = node_at_(pos);
+            if (!node) 
+                return 0;
+
+            item = etl::move(*node);
+            return erase_(node);
         }
 
         /// removes an item from the list at a specific position
-        int pop_at(size_t pos) const { 
-            auto node = head + pos;
-            if (pos == 0 && head) 
-                head = head.next();
-            
-            return node.erase();
-         }
+        int pop_at(size_t pos) const { return erase_(node_at_(pos)); }
 
         /// removes the first item from the list and retrieves its value
         int pop(reference item) const { return pop_at(item, 0); }
@@ -212,24 +217,41 @@ namespace Project::etl {
         /// removes the first item from the list
         int pop() const { return pop_at(0); }
 
-        /// removes the first item from the list
+        /// removes the last item from the list
         int pop_back() const { return pop_at(len() - 1); }
 
         /// removes the first item from the list
         int pop_front() const { return pop_at(0); }
         
-        /// removes the first item from the list
+        /// removes the last item from the list and retrieves its value
         int pop_back(T& item)  const { return pop_at(item, len() - 1); }
 
-        /// removes the first item from the list
+        /// removes the first item from the list and retrieves its value
         int pop_front(T& item) const { return pop_at(item, 0); }
 
     private:
         mutable iterator head;
+        mutable iterator last;
+        mutable size_t nItems = 0;
+
+        /// node at a specific position, the last node is reached without traversal
+        iterator node_at_(size_t pos) const { return pos + 1 == nItems ? last : head + pos; }
+
+        /// detach and delete a node of this list
+        int erase_(iterator node) const {
+            if (!node) 
+                return 0;
+
+            if (node == head) head = head.next();
+            if (node == last) last = last.prev();
+            node.erase();
+            --nItems;
+            return 1;
+        }
 
         /// make iterator
-        template <typename U> static auto
-        make_iterator(U&& item) { return iterator(new Node(etl::forward<U>(item))); }
+        template <typename... Args> static auto
+        make_iterator(Args&&... args) { return iterator(Node::create(etl::forward<Args>(args)...)); }
     };
 
     /// create linked list with variadic template function, the type can be explicitly specified
@@ -246,32 +268,31 @@ namespace Project::etl {
 
     template <typename T, typename A>
     struct LinkedList<T, A>::Node {
-        T* item = nullptr;
+        T item;
         mutable Node* next = nullptr;
         mutable Node* prev = nullptr;
-        
-        explicit Node(const T& it) {
-            A alloc;
-            item = alloc.allocate(1);
-            if (item) {
-                new (item) T(it);
-            }
-        }
 
-        explicit Node(T&& it) {
-            A alloc;
-            item = alloc.allocate(1);
-            if (item) {
-                new (item) T(etl::move(it));
-            }
+        template <typename... Args>
+        explicit Node(Args&&... args) : item(etl::forward<Args>(args)...) {}
+
+        /// allocate a node with a single allocation and construct the item in place
+        /// @retval null if allocation fails
+        template <typename... Args>
+        static Node* create(Args&&... args) {
+            node_allocator alloc;
+            auto node = alloc.allocate(1);
+            if (node) 
+                new (node) Node(etl::forward<Args>(args)...);
+            return node;
         }
 
-        ~Node() {
-            if (item) {
-                item->~T();
-                A alloc;
-                alloc.deallocate(item, 1);
-            }
+        /// destruct the item and deallocate the node
+        static void destroy(Node* node) {
+            if (!node)
+                return;
+            node->~Node();
+            node_allocator alloc;
+            alloc.deallocate(node, 1);
         }
     };
 
@@ -279,7 +300,7 @@ namespace Project::etl {
     template <typename U>
     class LinkedList<T, A>::Iterator {
         static_assert(is_same_v<U, Node*> || is_same_v<U, const Node*>, "the iterator has to be node pointer");
-        friend class LinkedList<T>;
+        friend class LinkedList<T, A>;
         Node* node;
 
         /// construct from node pointer
@@ -331,10 +352,10 @@ namespace Project::etl {
         /// arrow operator to access the item's member
         auto* operator->() const {
             if constexpr (is_const_v<remove_pointer_t<U>>) {
-                const auto it = node ? node->item : nullptr;
+                const auto it = node ? &node->item : nullptr;
                 return it;
             } else {
-                auto it = node ? node->item : nullptr;
+                auto it = node ? &node->item : nullptr;
                 return it;
             }
         }
@@ -343,10 +364,10 @@ namespace Project::etl {
         /// @warning make sure node is not null
         decltype(auto) operator*() const {
             if constexpr (is_const_v<remove_pointer_t<U>>) {
-                const auto& it = node ? *node->item : *static_cast<const T*>(nullptr);
+                const auto& it = node ? node->item : *static_cast<const T*>(nullptr);
                 return it;
             } else {
-                auto& it = node ? *node->item : *static_cast<T*>(nullptr);
+                auto& it = node ? node->item : *static_cast<T*>(nullptr);
                 return it;
             }
         }
@@ -468,7 +489,7 @@ namespace Project::etl {
         /// detach and delete this iterator
         int erase() {
             int res = detach();
-            delete node;
+            Node::destroy(node);
             node = nullptr;
             return res;
         }
@@ -482,6 +503,8 @@ namespace Project::etl {
     template <typename T, typename A> struct is_linked_list<const volatile LinkedList<T, A>> : true_type {};
     template <typename T> inline constexpr bool is_linked_list_v = is_linked_list<T>::value;
 
+    template <typename T, typename A> struct is_trivially_relocatable<LinkedList<T, A>> : true_type {};
+
     template <typename T, typename A> struct remove_extent<LinkedList<T, A>> { typedef T type; };
     template <typename T, typename A> struct remove_extent<const LinkedList<T, A>> { typedef T type; };
     template <typename T, typename A> struct remove_extent<volatile LinkedList<T, A>> { typedef T type; };
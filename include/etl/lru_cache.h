@@ -0,0 +1,526 @@
+#ifndef ETL_LRU_CACHE_H
+#define ETL_LRU_CACHE_H
+
+#include "etl/allocator.h"
+#include "etl/hash.h"
+#include <cstring> // memset
+#include <new>
+
+namespace Project::etl::detail {
+
+    /// recency list links of an lru cache entry
+    struct LruLink { uint32_t prev, next; };
+
+    /// state of a clock cache entry
+    struct ClockLink { uint32_t next; bool live, referenced; };
+
+    /// entry of a cache, the key and the value are constructed only while the entry is in use
+    template <typename K, typename V, typename Link>
+    struct CacheEntry : Link {
+        size_t hash;
+        alignas(K) unsigned char keyStorage[sizeof(K)];
+        alignas(V) unsigned char valueStorage[sizeof(V)];
+
+        K& key() { return *reinterpret_cast<K*>(keyStorage); }
+        const K& key() const { return *reinterpret_cast<const K*>(keyStorage); }
+        V& value() { return *reinterpret_cast<V*>(valueStorage); }
+        const V& value() const { return *reinterpret_cast<const V*>(valueStorage); }
+
+        template <typename KK, typename... Args>
+        void construct(KK&& k, size_t h, Args&&... args) {
+            new(keyStorage) K(etl::forward<KK>(k));
+            new(valueStorage) V(etl::forward<Args>(args)...);
+            hash = h;
+        }
+
+        void destroy() {
+            key().~K();
+            value().~V();
+        }
+    };
+
+    /// smallest power of two that keeps the index of a cache at most half full
+    constexpr size_t cache_slot_len(size_t capacity) {
+        size_t res = 2;
+        while (res < capacity * 2) res *= 2;
+        return res;
+    }
+
+    /// storage of the entries and the index of a cache, inline if the capacity is fixed at compile time
+    template <typename Entry, size_t N, typename A>
+    class CacheStorage {
+        alignas(Entry) unsigned char buf[N * sizeof(Entry)];
+        uint32_t slots[cache_slot_len(N)] = {};
+
+    public:
+        CacheStorage() {}
+        CacheStorage(const CacheStorage&) = delete;
+        CacheStorage& operator=(const CacheStorage&) = delete;
+
+        Entry* entries() { return reinterpret_cast<Entry*>(buf); }
+        const Entry* entries() const { return reinterpret_cast<const Entry*>(buf); }
+        uint32_t* index() { return slots; }
+        const uint32_t* index() const { return slots; }
+
+        static constexpr size_t capacity() { return N; }
+        static constexpr size_t slot_len() { return cache_slot_len(N); }
+    };
+
+    /// storage of the entries and the index of a cache, allocated once at construction
+    template <typename Entry, typename A>
+    class CacheStorage<Entry, 0, A> {
+        using entry_allocator = etl::allocator_rebind_t<A, Entry>;
+        using slot_allocator = etl::allocator_rebind_t<A, uint32_t>;
+
+        Entry* buf = nullptr;
+        uint32_t* slots = nullptr;
+        size_t cap = 0;
+
+    public:
+        explicit CacheStorage(size_t capacity) {
+            if (capacity == 0) return;
+            buf = entry_allocator().allocate(capacity);
+            slots = slot_allocator().allocate(cache_slot_len(capacity));
+            if (buf == nullptr || slots == nullptr) return;
+
+            ::memset((void*)slots, 0, cache_slot_len(capacity) * sizeof(uint32_t));
+            cap = capacity;
+        }
+
+        CacheStorage(const CacheStorage&) = delete;
+        CacheStorage& operator=(const CacheStorage&) = delete;
+
+        ~CacheStorage() {
+            if (buf) entry_allocator().deallocate(buf, cap);
+            if (slots) slot_allocator().deallocate(slots, cache_slot_len(cap));
+        }
+
+        Entry* entries() { return buf; }
+        const Entry* entries() const { return buf; }
+        uint32_t* index() { return slots; }
+        const uint32_t* index() const { return slots; }
+
+        size_t capacity() const { return cap; }
+        size_t slot_len() const { return cache_slot_len(cap); }
+    };
+
+    /// entry storage, open addressing index from keys to entries and the counters shared by the caches
+    template <typename Entry, typename K, size_t N, typename A>
+    class CacheBase {
+    protected:
+        static constexpr uint32_t npos = uint32_t(-1);
+
+        CacheStorage<Entry, N, A> storage;
+        size_t nItems = 0;
+        uint32_t fill = 0;          ///< number of entries that have ever been used
+        size_t nHits = 0, nMisses = 0, nEvictions = 0;
+
+        template <typename... Args>
+        explicit CacheBase(Args... args) : storage(args...) {}
+
+        /// index the entry at a position of the storage, the key must not be in the index yet
+        void index_(uint32_t entry) {
+            const Entry& e = storage.entries()[entry];
+            storage.index()[probe_(e.key(), e.hash)] = entry + 1;
+        }
+
+        /// empty the index
+        void reset_index_() {
+            ::memset((void*)storage.index(), 0, storage.slot_len() * sizeof(uint32_t));
+        }
+
+        /// position in the index of a key, or of the empty slot where it would be inserted
+        size_t probe_(const K& key, size_t h) const {
+            const size_t mask = storage.slot_len() - 1;
+            const uint32_t* slots = storage.index();
+            for (size_t i = h & mask;; i = (i + 1) & mask) {
+                if (slots[i] == 0) return i;
+                const Entry& e = storage.entries()[slots[i] - 1];
+                if (e.hash == h && e.key() == key) return i;
+            }
+        }
+
+        /// entry of a key, npos if the key is not cached
+        uint32_t lookup_(const K& key) const {
+            if (storage.capacity() == 0) return npos;
+            const uint32_t slot = storage.index()[probe_(key, etl::hash(key))];
+            return slot ? slot - 1 : npos;
+        }
+
+        /// remove an entry from the index, the following slots of the probe sequence are shifted back
+        /// so that there are no tombstones
+        void unindex_(const Entry& e) {
+            const size_t mask = storage.slot_len() - 1;
+            uint32_t* slots = storage.index();
+            size_t i = probe_(e.key(), e.hash);
+            slots[i] = 0;
+            for (size_t j = (i + 1) & mask; slots[j] != 0; j = (j + 1) & mask) {
+                const size_t home = storage.entries()[slots[j] - 1].hash & mask;
+                // the entry at j can fill the hole at i if its home is not within (i, j]
+                if (((j - home) & mask) >= ((j - i) & mask)) {
+                    slots[i] = etl::exchange(slots[j], 0);
+                    i = j;
+                }
+            }
+        }
+
+    public:
+        [[nodiscard]] size_t len() const { return nItems; } ///< returns the number of cached entries
+        [[nodiscard]] size_t capacity() const { return storage.capacity(); } ///< returns the maximum number of entries
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        size_t hits() const { return nHits; }           ///< number of lookups that found their key
+        size_t misses() const { return nMisses; }       ///< number of lookups that did not find their key
+        size_t evictions() const { return nEvictions; } ///< number of entries evicted to make room for new keys
+
+        /// reset the hit, miss, and eviction counters
+        void reset_stats() { nHits = nMisses = nEvictions = 0; }
+    };
+}
+
+namespace Project::etl {
+
+    /// key-value cache that evicts the least recently used entry when it is full.
+    /// an open addressing index finds the entries and an intrusive doubly linked list orders them by recency,
+    /// so every operation is O(1)
+    /// @tparam N fixed capacity with inline storage, or 0 for a capacity set at construction.
+    /// in both cases no allocation happens after construction
+    /// @note the key type must be hashable with etl::hash and comparable with operator==
+    template <typename K, typename V, size_t N = 0, typename A = etl::Allocator<Pair<K, V>>>
+    class LruCache : public detail::CacheBase<detail::CacheEntry<K, V, detail::LruLink>, K, N, A> {
+        typedef detail::CacheEntry<K, V, detail::LruLink> Entry;
+        typedef detail::CacheBase<Entry, K, N, A> Base;
+        using Base::npos;
+        using Base::storage;
+
+        uint32_t head = npos;       ///< most recently used entry
+        uint32_t tail = npos;       ///< least recently used entry
+        uint32_t freeList = npos;   ///< removed entries, linked by next
+
+    public:
+        typedef K Key;
+        typedef V Value;
+
+        /// construct a cache with fixed capacity N
+        template <size_t M = N, typename = etl::enable_if_t<M != 0>>
+        LruCache() : Base() {}
+
+        /// construct a cache and allocate the storage for a number of entries
+        /// @note the capacity is 0 if allocation fails
+        template <size_t M = N, typename = etl::enable_if_t<M == 0>>
+        explicit LruCache(size_t capacity) : Base(capacity) {}
+
+        LruCache(const LruCache&) = delete;
+        LruCache& operator=(const LruCache&) = delete;
+
+        /// destructor
+        ~LruCache() { clear(); }
+
+        /// check if a key is cached, the recency and the counters are not updated
+        bool has(const K& key) const { return this->lookup_(key) != npos; }
+
+        /// pointer to the value of a key without updating the recency and the counters, null if the key is not cached
+        const V* peek(const K& key) const {
+            const uint32_t i = this->lookup_(key);
+            return i == npos ? nullptr : &storage.entries()[i].value();
+        }
+
+        /// pointer to the value of a key, null if the key is not cached.
+        /// a hit makes the entry the most recently used
+        V* find(const K& key) {
+            const uint32_t i = this->lookup_(key);
+            if (i == npos) {
+                ++this->nMisses;
+                return nullptr;
+            }
+            ++this->nHits;
+            touch_(i);
+            return &storage.entries()[i].value();
+        }
+
+        /// get the value of a key
+        /// @warning it will throw error null dereference if the key is not cached
+        V& get(const K& key) { return *find(key); }
+
+        /// insert or assign the value of a key, the least recently used entry is evicted if the cache is full
+        /// @return pointer to the cached value, null if the capacity is 0
+        template <typename KK, typename VV>
+        V* put(KK&& key, VV&& value) {
+            if (storage.capacity() == 0) return nullptr;
+
+            K k(etl::forward<KK>(key));
+            const size_t h = etl::hash(k);
+            const uint32_t slot = storage.index()[this->probe_(k, h)];
+            if (slot) {
+                Entry& e = storage.entries()[slot - 1];
+                e.value() = etl::forward<VV>(value);
+                touch_(slot - 1);
+                return &e.value();
+            }
+
+            const uint32_t i = take_();
+            Entry& e = storage.entries()[i];
+            e.construct(etl::move(k), h, etl::forward<VV>(value));
+            this->index_(i);
+            link_front_(i);
+            ++this->nItems;
+            return &e.value();
+        }
+
+        /// remove the entry of a key
+        /// @return false if the key is not cached
+        bool remove(const K& key) {
+            const uint32_t i = this->lookup_(key);
+            if (i == npos) return false;
+            release_(i);
+            storage.entries()[i].next = freeList;
+            freeList = i;
+            return true;
+        }
+
+        /// remove all entries, the counters are kept
+        void clear() {
+            for (uint32_t i = head; i != npos; i = storage.entries()[i].next)
+                storage.entries()[i].destroy();
+            if (storage.capacity()) this->reset_index_();
+            head = tail = freeList = npos;
+            this->fill = 0;
+            this->nItems = 0;
+        }
+
+        /// call a function for every entry from the most to the least recently used, the recency is not updated
+        template <typename F>
+        void foreach(F&& fn) const {
+            for (uint32_t i = head; i != npos; i = storage.entries()[i].next) {
+                const Entry& e = storage.entries()[i];
+                fn(e.key(), e.value());
+            }
+        }
+
+    private:
+        /// entry for a new key: a removed entry, an entry never used, or the evicted least recently used entry
+        uint32_t take_() {
+            if (freeList != npos) {
+                const uint32_t i = freeList;
+                freeList = storage.entries()[i].next;
+                return i;
+            }
+            if (this->fill < storage.capacity()) {
+                new(storage.entries() + this->fill) Entry;
+                return this->fill++;
+            }
+
+            const uint32_t i = tail;
+            release_(i);
+            ++this->nEvictions;
+            return i;
+        }
+
+        /// unindex, unlink and destroy the key and value of an entry
+        void release_(uint32_t i) {
+            Entry& e = storage.entries()[i];
+            this->unindex_(e);
+            unlink_(i);
+            e.destroy();
+            --this->nItems;
+        }
+
+        void touch_(uint32_t i) {
+            if (i == head) return;
+            unlink_(i);
+            link_front_(i);
+        }
+
+        void link_front_(uint32_t i) {
+            Entry& e = storage.entries()[i];
+            e.prev = npos;
+            e.next = head;
+            if (head != npos) storage.entries()[head].prev = i;
+            else tail = i;
+            head = i;
+        }
+
+        void unlink_(uint32_t i) {
+            Entry& e = storage.entries()[i];
+            if (e.prev != npos) storage.entries()[e.prev].next = e.next;
+            else head = e.next;
+            if (e.next != npos) storage.entries()[e.next].prev = e.prev;
+            else tail = e.prev;
+        }
+    };
+
+    /// key-value cache with the CLOCK (second chance) eviction policy, an approximation of LRU.
+    /// a hit only sets the reference bit of the entry instead of relinking it, and when the cache is full
+    /// a hand sweeps the entries in a circle, clearing reference bits until it finds an entry without one to evict
+    /// @tparam N fixed capacity with inline storage, or 0 for a capacity set at construction.
+    /// in both cases no allocation happens after construction
+    /// @note the key type must be hashable with etl::hash and comparable with operator==
+    template <typename K, typename V, size_t N = 0, typename A = etl::Allocator<Pair<K, V>>>
+    class ClockCache : public detail::CacheBase<detail::CacheEntry<K, V, detail::ClockLink>, K, N, A> {
+        typedef detail::CacheEntry<K, V, detail::ClockLink> Entry;
+        typedef detail::CacheBase<Entry, K, N, A> Base;
+        using Base::npos;
+        using Base::storage;
+
+        uint32_t hand = 0;
+        uint32_t freeList = npos;   ///< removed entries, linked by next
+
+    public:
+        typedef K Key;
+        typedef V Value;
+
+        /// construct a cache with fixed capacity N
+        template <size_t M = N, typename = etl::enable_if_t<M != 0>>
+        ClockCache() : Base() {}
+
+        /// construct a cache and allocate the storage for a number of entries
+        /// @note the capacity is 0 if allocation fails
+        template <size_t M = N, typename = etl::enable_if_t<M == 0>>
+        explicit ClockCache(size_t capacity) : Base(capacity) {}
+
+        ClockCache(const ClockCache&) = delete;
+        ClockCache& operator=(const ClockCache&) = delete;
+
+        /// destructor
+        ~ClockCache() { clear(); }
+
+        /// check if a key is cached, the reference bit and the counters are not updated
+        bool has(const K& key) const { return this->lookup_(key) != npos; }
+
+        /// pointer to the value of a key without updating the reference bit and the counters, null if the key is not cached
+        const V* peek(const K& key) const {
+            const uint32_t i = this->lookup_(key);
+            return i == npos ? nullptr : &storage.entries()[i].value();
+        }
+
+        /// pointer to the value of a key, null if the key is not cached.
+        /// a hit sets the reference bit of the entry
+        V* find(const K& key) {
+            const uint32_t i = this->lookup_(key);
+            if (i == npos) {
+                ++this->nMisses;
+                return nullptr;
+            }
+            ++this->nHits;
+            Entry& e = storage.entries()[i];
+            e.referenced = true;
+            return &e.value();
+        }
+
+        /// get the value of a key
+        /// @warning it will throw error null dereference if the key is not cached
+        V& get(const K& key) { return *find(key); }
+
+        /// insert or assign the value of a key, an entry is evicted by the clock hand if the cache is full
+        /// @return pointer to the cached value, null if the capacity is 0
+        template <typename KK, typename VV>
+        V* put(KK&& key, VV&& value) {
+            if (storage.capacity() == 0) return nullptr;
+
+            K k(etl::forward<KK>(key));
+            const size_t h = etl::hash(k);
+            const uint32_t slot = storage.index()[this->probe_(k, h)];
+            if (slot) {
+                Entry& e = storage.entries()[slot - 1];
+                e.value() = etl::forward<VV>(value);
+                e.referenced = true;
+                return &e.value();
+            }
+
+            const uint32_t i = take_();
+            Entry& e = storage.entries()[i];
+            e.construct(etl::move(k), h, etl::forward<VV>(value));
+            e.live = true;
+            e.referenced = false;
+            this->index_(i);
+            ++this->nItems;
+            return &e.value();
+        }
+
+        /// remove the entry of a key
+        /// @return false if the key is not cached
+        bool remove(const K& key) {
+            const uint32_t i = this->lookup_(key);
+            if (i == npos) return false;
+            release_(i);
+            storage.entries()[i].next = freeList;
+            freeList = i;
+            return true;
+        }
+
+        /// remove all entries, the counters are kept
+        void clear() {
+            for (uint32_t i = 0; i < this->fill; ++i) {
+                if (storage.entries()[i].live) storage.entries()[i].destroy();
+            }
+            if (storage.capacity()) this->reset_index_();
+            hand = this->fill = 0;
+            freeList = npos;
+            this->nItems = 0;
+        }
+
+        /// call a function for every entry in storage order, the reference bits are not updated
+        template <typename F>
+        void foreach(F&& fn) const {
+            for (uint32_t i = 0; i < this->fill; ++i) {
+                const Entry& e = storage.entries()[i];
+                if (e.live) fn(e.key(), e.value());
+            }
+        }
+
+    private:
+        /// entry for a new key: a removed entry, an entry never used, or the first entry under the hand without reference bit
+        uint32_t take_() {
+            if (freeList != npos) {
+                const uint32_t i = freeList;
+                freeList = storage.entries()[i].next;
+                return i;
+            }
+            if (this->fill < storage.capacity()) {
+                new(storage.entries() + this->fill) Entry;
+                return this->fill++;
+            }
+
+            while (true) {
+                const uint32_t i = hand;
+                hand = hand + 1 == storage.capacity() ? 0 : hand + 1;
+
+                Entry& e = storage.entries()[i];
+                if (e.referenced) {
+                    e.referenced = false;
+                } else {
+                    release_(i);
+                    ++this->nEvictions;
+                    return i;
+                }
+            }
+        }
+
+        void release_(uint32_t i) {
+            Entry& e = storage.entries()[i];
+            this->unindex_(e);
+            e.destroy();
+            e.live = false;
+            --this->nItems;
+        }
+    };
+
+    /// type traits
+    template <typename T> struct is_lru_cache : false_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_lru_cache<LruCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_lru_cache<const LruCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_lru_cache<volatile LruCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_lru_cache<const volatile LruCache<K, V, N, A>> : true_type {};
+    template <typename T> inline constexpr bool is_lru_cache_v = is_lru_cache<T>::value;
+
+    template <typename T> struct is_clock_cache : false_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_clock_cache<ClockCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_clock_cache<const ClockCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_clock_cache<volatile ClockCache<K, V, N, A>> : true_type {};
+    template <typename K, typename V, size_t N, typename A> struct is_clock_cache<const volatile ClockCache<K, V, N, A>> : true_type {};
+    template <typename T> inline constexpr bool is_clock_cache_v = is_clock_cache<T>::value;
+}
+
+#endif //ETL_LRU_CACHE_H
@@ -53,26 +53,19 @@ namespace Project::etl {
         }
     
         V* find(const K& key) {
-            V* res = nullptr;
-            for (auto &[x, y]: *this) if (x == key) res = &y;
-            return res;
+            for (auto &[x, y]: *this) if (x == key) return &y;
+            return nullptr;
         }
 
         const V* find(const K& key) const {
-            const V* res = nullptr;
-            for (auto &[x, y]: *this) if (x == key) res = &y;
-            return res;
+            for (auto &[x, y]: *this) if (x == key) return &y;
+            return nullptr;
         }
 
     private:
         template <typename KK, typename VV>
         void append_pair(KK&& key, VV&& value) {
-            auto newCapacity = this->len() + 1;
-
-            if (this->size() < newCapacity && !this->reserve(newCapacity))
-                return;
-            
-            this->append(etl::Pair<K, V>{K(etl::forward<KK>(key)), V(etl::forward<VV>(value))});
+            this->emplace_back(etl::Pair<K, V>{K(etl::forward<KK>(key)), V(etl::forward<VV>(value))});
         }
     };
 
@@ -106,6 +99,8 @@ namespace Project::etl {
     template <typename K, typename V, typename A> struct is_map<const volatile Map<K, V, A>> : true_type {};
     template <typename T> inline constexpr bool is_map_v = is_map<T>::value;
 
+    template <typename K, typename V, typename A> struct is_trivially_relocatable<Map<K, V, A>> : true_type {};
+
     template <typename K, typename V, typename A> struct remove_extent<Map<K, V, A>> { typedef Pair<K, V> type; };
     template <typename K, typename V, typename A> struct remove_extent<const Map<K, V, A>> { typedef Pair<K, V> type; };
     template <typename K, typename V, typename A> struct remove_extent<volatile Map<K, V, A>> { typedef Pair<K, V> type; };
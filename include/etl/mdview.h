@@ -0,0 +1,338 @@
+#ifndef ETL_MDVIEW_H
+#define ETL_MDVIEW_H
+
+#include "etl/range.h"
+
+namespace Project::etl {
+
+    /// layouts of a multidimensional view
+    struct RowMajor {};     ///< the last index is contiguous, as in C arrays
+    struct ColumnMajor {};  ///< the first index is contiguous, as in Fortran
+    struct Strided {};      ///< every dimension has its own stride, as produced by slicing
+
+    /// slice that keeps a whole dimension, see BasicMdView::subview
+    struct FullExtent {};
+    inline constexpr FullExtent full_extent = {};
+
+    template <typename T, typename Layout, size_t... Extents> class BasicMdView;
+    template <typename T, typename Layout, size_t... Extents> class MdRowIterator;
+
+    /// multidimensional view with row-major layout
+    template <typename T, size_t... Extents> using MdView = BasicMdView<T, RowMajor, Extents...>;
+}
+
+namespace Project::etl::detail {
+
+    /// view of the dimensions after the first one
+    template <typename T, typename Layout, size_t E, size_t... Es>
+    struct mdview_row { typedef BasicMdView<T, etl::conditional_t<etl::is_same_v<Layout, RowMajor>, RowMajor, Strided>, Es...> type; };
+
+    /// view of N dynamic extents
+    template <typename T, typename Layout, size_t N, size_t... Es>
+    struct mdview_dynamic { typedef typename mdview_dynamic<T, Layout, N - 1, dynamic_extent, Es...>::type type; };
+
+    template <typename T, typename Layout, size_t... Es>
+    struct mdview_dynamic<T, Layout, 0, Es...> { typedef BasicMdView<T, Layout, Es...> type; };
+
+    template <typename Sequence> constexpr auto
+    mdview_data(Sequence&& seq) {
+        if constexpr (etl::is_pointer_v<etl::decay_t<Sequence>>) return seq;
+        else return seq.data();
+    }
+}
+
+namespace Project::etl {
+
+    /// iterator over the elements of a one-dimensional view, it steps by the stride of the view
+    template <typename T>
+    class StrideIterator {
+        T* ptr;
+        size_t stride;
+
+    public:
+        constexpr StrideIterator(T* ptr, size_t stride) : ptr(ptr), stride(stride) {}
+
+        constexpr T& operator*() const { return *ptr; }
+        constexpr T* operator->() const { return ptr; }
+
+        constexpr bool operator==(const StrideIterator& other) const { return ptr == other.ptr; }
+        constexpr bool operator!=(const StrideIterator& other) const { return ptr != other.ptr; }
+
+        constexpr StrideIterator& operator++() { ptr += stride; return *this; }
+        constexpr StrideIterator& operator--() { ptr -= stride; return *this; }
+
+        constexpr StrideIterator operator+(int n) const { return { ptr + n * ptrdiff_t(stride), stride }; }
+        constexpr StrideIterator operator-(int n) const { return { ptr - n * ptrdiff_t(stride), stride }; }
+
+        constexpr size_t operator-(const StrideIterator& other) const { return size_t(ptr - other.ptr) / stride; }
+    };
+
+    /// non-owning view of a multidimensional grid of elements, the elements are not copied.
+    /// every extent is either fixed at compile time or etl::dynamic_extent, fixed extents and contiguous strides
+    /// are compile time constants in the index computation, so loops over the last index of a row-major view
+    /// (or the first index of a column-major view) access consecutive elements and can be vectorized
+    /// @note iterating a view of rank greater than 1 yields the views of its rows
+    template <typename T, typename Layout, size_t... Extents>
+    class BasicMdView {
+        template <typename, typename, size_t...> friend class BasicMdView;
+
+        static constexpr size_t R = sizeof...(Extents);
+        static_assert(R > 0, "Multidimensional view needs at least one dimension");
+        static_assert(etl::is_same_v<Layout, RowMajor> || etl::is_same_v<Layout, ColumnMajor> || etl::is_same_v<Layout, Strided>,
+            "Unknown layout");
+
+        static constexpr size_t static_extents[R] = { Extents... };
+
+        T* ptr = nullptr;
+        size_t extents[R] = { (Extents == dynamic_extent ? 0 : Extents)... };
+        size_t strides[R] = {};
+
+    public:
+        typedef T value_type;
+        typedef Layout layout_type;
+        typedef etl::conditional_t<R == 1, StrideIterator<T>, MdRowIterator<T, Layout, Extents...>> iterator;
+        typedef iterator const_iterator;
+
+        /// empty constructor, the dynamic extents are 0
+        constexpr BasicMdView() { set_strides_(); }
+
+        /// construct from a pointer and either the dynamic extents or all the extents
+        template <typename... Is, typename = enable_if_t<(etl::is_integral_v<Is> && ...)>>
+        constexpr explicit BasicMdView(T* ptr, Is... exts) : ptr(ptr) {
+            static_assert(!etl::is_same_v<Layout, Strided>, "Strided view needs the strides");
+            static_assert(sizeof...(Is) == rank_dynamic() || sizeof...(Is) == R, "Invalid number of extents");
+
+            const size_t values[] = { size_t(exts)..., 0 };
+            for (size_t d = 0, k = 0; d < R; ++d) {
+                if (sizeof...(Is) == R) k = d;
+                if (static_extents[d] == dynamic_extent) extents[d] = values[k++];
+            }
+            set_strides_();
+        }
+
+        /// construct a strided view from a pointer, all the extents, and the strides in number of elements
+        constexpr BasicMdView(T* ptr, const size_t (&exts)[R], const size_t (&strs)[R]) : ptr(ptr) {
+            static_assert(etl::is_same_v<Layout, Strided>, "Only a strided view takes the strides");
+            for (size_t d = 0; d < R; ++d) {
+                if (static_extents[d] == dynamic_extent) extents[d] = exts[d];
+                strides[d] = strs[d];
+            }
+        }
+
+        /// conversion from a view of non-const elements, or from any layout to the strided layout
+        template <typename U, typename L, typename = enable_if_t<etl::is_convertible_v<U(*)[], T(*)[]> &&
+            (etl::is_same_v<L, Layout> || etl::is_same_v<Layout, Strided>)>>
+        constexpr BasicMdView(const BasicMdView<U, L, Extents...>& other) : ptr(other.ptr) {
+            for (size_t d = 0; d < R; ++d) {
+                extents[d] = other.extents[d];
+                strides[d] = other.strides[d];
+            }
+        }
+
+        static constexpr size_t rank() { return R; }
+        static constexpr size_t rank_dynamic() { return ((Extents == dynamic_extent) + ...); }
+        static constexpr size_t static_extent(size_t r) { return static_extents[r]; }
+
+        constexpr size_t extent(size_t r) const { return extents[r]; }
+        constexpr size_t stride(size_t r) const { return strides[r]; }
+
+        /// number of elements
+        constexpr size_t size() const {
+            size_t res = 1;
+            for (size_t d = 0; d < R; ++d) res *= extents[d];
+            return res;
+        }
+
+        /// number of items of the first dimension, elements if the rank is 1 and rows otherwise
+        [[nodiscard]] constexpr size_t len() const { return extent_<0>(); }
+
+        /// return true if the view points to something
+        constexpr explicit operator bool() const { return ptr != nullptr; }
+
+        constexpr T* data() const { return ptr; }
+
+        constexpr iterator begin() const {
+            if constexpr (R == 1) return { ptr, stride_<0>() };
+            else return { *this, 0 };
+        }
+
+        constexpr iterator end() const {
+            if constexpr (R == 1) return { ptr + len() * stride_<0>(), stride_<0>() };
+            else return { *this, len() };
+        }
+
+        constexpr Iter<iterator> iter() const { return Iter(begin(), end(), 1); }
+        constexpr Iter<iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// element access, the indices are not checked
+        template <typename... Is, typename = enable_if_t<sizeof...(Is) == R && (etl::is_integral_v<Is> && ...)>>
+        constexpr T& operator()(Is... idx) const { return ptr[offset_(etl::make_index_sequence<R>(), idx...)]; }
+
+        /// item of the first dimension, the element if the rank is 1 or the view of a row otherwise
+        /// @note the index is not checked
+        constexpr decltype(auto) operator[](size_t i) const {
+            if constexpr (R == 1) return ptr[i * stride_<0>()];
+            else return row_(i);
+        }
+
+        /// slice operator of a view of rank 1, the same as the slice operator of the sequences
+        template <size_t RR = R, typename = enable_if_t<RR == 1>>
+        constexpr Iter<iterator> operator()(int start, int stop, int step = 1) const {
+            const int n = int(len());
+            if (start < 0) start += n;
+            if (stop < 0) stop += n;
+            return start < stop ? Iter(begin() + start, begin() + stop, step) : Iter(begin(), begin(), step);
+        }
+
+        /// call a function with every element, the innermost loop runs over the contiguous dimension
+        template <typename F>
+        constexpr void foreach(F&& fn) const { foreach_<0>(ptr, fn); }
+
+        /// view of a part of this view, given one slice per dimension.
+        /// an integer keeps a single index and drops the dimension, etl::full_extent keeps the whole dimension,
+        /// and a range with a positive step keeps the indices of the range, e.g. etl::range(1, 9, 2)
+        /// @return strided view with dynamic extents
+        template <typename... Slices>
+        constexpr auto subview(Slices... slices) const {
+            static_assert(sizeof...(Slices) == R, "One slice per dimension");
+            constexpr size_t N = ((!etl::is_integral_v<Slices>) + ...);
+            static_assert(N > 0, "At least one dimension must be kept");
+
+            typename detail::mdview_dynamic<T, Strided, N>::type res;
+            res.ptr = ptr;
+            size_t k = 0;
+            subview_<0>(res, k, slices...);
+            return res;
+        }
+
+    private:
+        template <size_t D> constexpr size_t extent_() const {
+            if constexpr (static_extents[D] != dynamic_extent) return static_extents[D];
+            else return extents[D];
+        }
+
+        /// stride that is known at compile time, the product of the static extents of the faster dimensions
+        static constexpr size_t static_stride_(size_t d) {
+            if (etl::is_same_v<Layout, Strided>) return dynamic_extent;
+            size_t res = 1;
+            const size_t first = etl::is_same_v<Layout, RowMajor> ? d + 1 : 0;
+            const size_t last = etl::is_same_v<Layout, RowMajor> ? R : d;
+            for (size_t k = first; k < last; ++k) {
+                if (static_extents[k] == dynamic_extent) return dynamic_extent;
+                res *= static_extents[k];
+            }
+            return res;
+        }
+
+        template <size_t D> constexpr size_t stride_() const {
+            if constexpr (static_stride_(D) != dynamic_extent) return static_stride_(D);
+            else return strides[D];
+        }
+
+        constexpr void set_strides_() {
+            if constexpr (etl::is_same_v<Layout, RowMajor>) {
+                size_t s = 1;
+                for (size_t d = R; d-- > 0; s *= extents[d]) strides[d] = s;
+            } else if constexpr (etl::is_same_v<Layout, ColumnMajor>) {
+                size_t s = 1;
+                for (size_t d = 0; d < R; s *= extents[d], ++d) strides[d] = s;
+            }
+        }
+
+        template <size_t... Ds, typename... Is>
+        constexpr size_t offset_(etl::index_sequence<Ds...>, Is... idx) const { return ((size_t(idx) * stride_<Ds>()) + ...); }
+
+        constexpr auto row_(size_t i) const {
+            typename detail::mdview_row<T, Layout, Extents...>::type res;
+            res.ptr = ptr + i * stride_<0>();
+            for (size_t d = 1; d < R; ++d) {
+                res.extents[d - 1] = extents[d];
+                res.strides[d - 1] = strides[d];
+            }
+            return res;
+        }
+
+        template <size_t K, typename F>
+        constexpr void foreach_(T* p, F& fn) const {
+            constexpr size_t D = etl::is_same_v<Layout, ColumnMajor> ? R - 1 - K : K;
+            const size_t n = extent_<D>();
+            const size_t s = stride_<D>();
+            if constexpr (K + 1 == R) {
+                for (size_t i = 0; i < n; ++i) fn(p[i * s]);
+            } else {
+                for (size_t i = 0; i < n; ++i) foreach_<K + 1>(p + i * s, fn);
+            }
+        }
+
+        template <size_t D, typename V, typename S, typename... Ss>
+        constexpr void subview_(V& res, size_t& k, S slice, Ss... rest) const {
+            if constexpr (etl::is_integral_v<S>) {
+                res.ptr += size_t(slice) * strides[D];
+            } else if constexpr (etl::is_same_v<S, FullExtent>) {
+                res.extents[k] = extents[D];
+                res.strides[k++] = strides[D];
+            } else {
+                const size_t n = slice.len();
+                const size_t step = n > 1 ? size_t(slice[1] - slice[0]) : 1;
+                if (n > 0) res.ptr += size_t(*slice) * strides[D];
+                res.extents[k] = n;
+                res.strides[k++] = strides[D] * step;
+            }
+            if constexpr (sizeof...(Ss) > 0) subview_<D + 1>(res, k, rest...);
+        }
+    };
+
+    /// iterator over the rows of a view, dereferencing yields the view of a row
+    template <typename T, typename Layout, size_t... Extents>
+    class MdRowIterator {
+        BasicMdView<T, Layout, Extents...> view;
+        size_t i;
+
+    public:
+        constexpr MdRowIterator(const BasicMdView<T, Layout, Extents...>& view, size_t i) : view(view), i(i) {}
+
+        constexpr auto operator*() const { return view[i]; }
+
+        constexpr bool operator==(const MdRowIterator& other) const { return i == other.i; }
+        constexpr bool operator!=(const MdRowIterator& other) const { return i != other.i; }
+
+        constexpr MdRowIterator& operator++() { ++i; return *this; }
+        constexpr MdRowIterator& operator--() { --i; return *this; }
+
+        constexpr MdRowIterator operator+(int n) const { return { view, i + n }; }
+        constexpr MdRowIterator operator-(int n) const { return { view, i - n }; }
+
+        constexpr size_t operator-(const MdRowIterator& other) const { return i - other.i; }
+    };
+
+    /// create row-major view of a pointer, a vector or an array. the extents are template arguments,
+    /// the dynamic ones are given as function arguments
+    /// @code auto image = etl::mdview<etl::dynamic_extent, 640>(pixels, height); @endcode
+    template <size_t... Extents, typename Sequence, typename... Is> constexpr auto
+    mdview(Sequence&& seq, Is... exts) {
+        auto ptr = detail::mdview_data(seq);
+        return BasicMdView<etl::remove_pointer_t<decltype(ptr)>, RowMajor, Extents...>(ptr, exts...);
+    }
+
+    /// create column-major view of a pointer, a vector or an array
+    template <size_t... Extents, typename Sequence, typename... Is> constexpr auto
+    mdview_column_major(Sequence&& seq, Is... exts) {
+        auto ptr = detail::mdview_data(seq);
+        return BasicMdView<etl::remove_pointer_t<decltype(ptr)>, ColumnMajor, Extents...>(ptr, exts...);
+    }
+
+    /// type traits
+    template <typename T> struct is_mdview : false_type {};
+    template <typename T, typename L, size_t... Es> struct is_mdview<BasicMdView<T, L, Es...>> : true_type {};
+    template <typename T, typename L, size_t... Es> struct is_mdview<const BasicMdView<T, L, Es...>> : true_type {};
+    template <typename T, typename L, size_t... Es> struct is_mdview<volatile BasicMdView<T, L, Es...>> : true_type {};
+    template <typename T, typename L, size_t... Es> struct is_mdview<const volatile BasicMdView<T, L, Es...>> : true_type {};
+    template <typename T> inline constexpr bool is_mdview_v = is_mdview<T>::value;
+
+    template <typename T, typename L, size_t... Es> struct remove_extent<BasicMdView<T, L, Es...>> { typedef T type; };
+    template <typename T, typename L, size_t... Es> struct remove_extent<const BasicMdView<T, L, Es...>> { typedef T type; };
+    template <typename T, typename L, size_t... Es> struct remove_extent<volatile BasicMdView<T, L, Es...>> { typedef T type; };
+    template <typename T, typename L, size_t... Es> struct remove_extent<const volatile BasicMdView<T, L, Es...>> { typedef T type; };
+}
+
+#endif //ETL_MDVIEW_H
@@ -2,6 +2,72 @@
 #define ETL_ALIGNED_STORAGE_H
 
 #include "etl/utility_basic.h"
+#include <cstring> // memcpy, memmove
+#include <new>
+
+namespace Project::etl::detail {
+
+    /// move n items from src to the uninitialized dest and end the lifetime of the sources,
+    /// bytewise if T is trivially relocatable. the ranges must not overlap
+    template <typename T> void
+    uninitialized_relocate(T* src, size_t n, T* dest) {
+        if constexpr (etl::is_trivially_relocatable_v<T>) {
+            if (n) ::memcpy((void*)dest, (const void*)src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                new(dest + i) T(etl::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    /// move the items [index, n) of buf to the back by count positions, leaving an uninitialized gap at index.
+    /// the capacity of buf must be at least n + count
+    template <typename T> void
+    relocate_gap(T* buf, size_t n, size_t index, size_t count) {
+        if constexpr (etl::is_trivially_relocatable_v<T>) {
+            ::memmove((void*)(buf + index + count), (const void*)(buf + index), (n - index) * sizeof(T));
+        } else {
+            for (size_t i = n; i > index; --i) {
+                new(buf + i - 1 + count) T(etl::move(buf[i - 1]));
+                buf[i - 1].~T();
+            }
+        }
+    }
+
+    /// construct an item at index of buf holding n items, index must be less than n and the capacity at least n + 1.
+    /// the item is constructed before any element is moved, so it may alias an element
+    template <typename T, typename U> void
+    relocate_insert(T* buf, size_t n, size_t index, U&& item) {
+        if constexpr (etl::is_trivially_relocatable_v<T>) {
+            // construct at the back then rotate the bytes into place
+            alignas(T) unsigned char temp[sizeof(T)];
+            new(buf + n) T(etl::forward<U>(item));
+            ::memcpy(temp, (const void*)(buf + n), sizeof(T));
+            ::memmove((void*)(buf + index + 1), (const void*)(buf + index), (n - index) * sizeof(T));
+            ::memcpy((void*)(buf + index), temp, sizeof(T));
+        } else {
+            T temp(etl::forward<U>(item));
+            new(buf + n) T(etl::move(buf[n - 1]));
+            for (size_t i = n - 1; i > index; --i)
+                buf[i] = etl::move(buf[i - 1]);
+            buf[index] = etl::move(temp);
+        }
+    }
+
+    /// destroy the item at index of buf holding n items and move the items behind it to the front by one position
+    template <typename T> void
+    relocate_erase(T* buf, size_t n, size_t index) {
+        if constexpr (etl::is_trivially_relocatable_v<T>) {
+            buf[index].~T();
+            ::memmove((void*)(buf + index), (const void*)(buf + index + 1), (n - index - 1) * sizeof(T));
+        } else {
+            for (; index + 1 < n; ++index)
+                buf[index] = etl::move(buf[index + 1]);
+            buf[n - 1].~T();
+        }
+    }
+}
 
 namespace Project::etl {
     
@@ -0,0 +1,169 @@
+#ifndef ETL_MPMC_QUEUE_H
+#define ETL_MPMC_QUEUE_H
+
+#include "etl/algorithm.h"
+#include <atomic>
+#include <thread> // yield
+#include <new>
+
+#ifndef ETL_CACHE_LINE_SIZE
+#define ETL_CACHE_LINE_SIZE 64
+#endif
+
+namespace Project::etl {
+
+    /// lock-free bounded multi-producer multi-consumer queue, the items are stored in place.
+    /// each slot carries a sequence number telling whether it is ready to be written or read in the current lap,
+    /// so producers and consumers only contend on their own position counter
+    /// @tparam N capacity, has to be a power of two
+    template <typename T, size_t N>
+    class MpmcQueue {
+        static_assert(N > 1 && (N & (N - 1)) == 0, "capacity has to be a power of two greater than one");
+        static constexpr size_t mask = N - 1;
+
+        struct Slot {
+            std::atomic<size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* item() { return reinterpret_cast<T*>(storage); }
+        };
+
+        alignas(ETL_CACHE_LINE_SIZE) Slot slots[N];
+        alignas(ETL_CACHE_LINE_SIZE) std::atomic<size_t> enqueuePos {0};
+        alignas(ETL_CACHE_LINE_SIZE) std::atomic<size_t> dequeuePos {0};
+
+    public:
+        typedef T value_type;
+
+        /// empty constructor
+        MpmcQueue() {
+            for (size_t i = 0; i < N; ++i) slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        /// destructor, remaining items are destroyed
+        ~MpmcQueue() {
+            auto last = enqueuePos.load(std::memory_order_acquire);
+            for (auto pos = dequeuePos.load(std::memory_order_acquire); pos != last; ++pos)
+                slots[pos & mask].item()->~T();
+        }
+
+        /// @retval number of items, only a snapshot under concurrent access
+        size_t len() const {
+            size_t e = enqueuePos.load(std::memory_order_acquire);
+            size_t d = dequeuePos.load(std::memory_order_acquire);
+            return e > d ? etl::min(e - d, N) : 0;
+        }
+
+        /// @retval capacity
+        static constexpr size_t size() { return N; }
+
+        /// construct an item in place at the back without blocking
+        /// @return 0: the queue is full, 1: success
+        template <typename... Args>
+        int try_emplace(Args&&... args) {
+            size_t pos = enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& slot = slots[pos & mask];
+                size_t seq = slot.sequence.load(std::memory_order_acquire);
+                auto diff = intptr_t(seq) - intptr_t(pos);
+
+                if (diff == 0) {
+                    // the slot is free in this lap, claim it
+                    if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        new(slot.item()) T(etl::forward<Args>(args)...);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return 1;
+                    }
+                } else if (diff < 0) {
+                    return 0; // the slot still holds an item of the previous lap
+                } else {
+                    pos = enqueuePos.load(std::memory_order_relaxed); // another producer took it
+                }
+            }
+        }
+
+        /// push an item at the back without blocking
+        /// @return 0: the queue is full, 1: success
+        template <typename U>
+        int try_push(U&& item) { return try_emplace(etl::forward<U>(item)); }
+
+        /// push an item at the back, yield the thread while the queue is full
+        /// @note the item is only forwarded once a slot is claimed
+        template <typename U>
+        void push(U&& item) {
+            while (!try_emplace(etl::forward<U>(item))) std::this_thread::yield();
+        }
+
+        /// removes the oldest item and retrieves its value without blocking
+        /// @return 0: the queue is empty, 1: success
+        int try_pop(T& item) {
+            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                Slot& slot = slots[pos & mask];
+                size_t seq = slot.sequence.load(std::memory_order_acquire);
+                auto diff = intptr_t(seq) - intptr_t(pos + 1);
+
+                if (diff == 0) {
+                    // the slot is written in this lap, claim it
+                    if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        release_(slot, pos, item);
+                        return 1;
+                    }
+                } else if (diff < 0) {
+                    return 0; // the slot is not written yet
+                } else {
+                    pos = dequeuePos.load(std::memory_order_relaxed); // another consumer took it
+                }
+            }
+        }
+
+        /// removes the oldest item and retrieves its value, yield the thread while the queue is empty
+        void pop(T& item) {
+            while (!try_pop(item)) std::this_thread::yield();
+        }
+
+        /// removes up to n oldest items that are ready without blocking, the items are claimed at once
+        /// @return number of popped items
+        size_t try_pop_n(T* dest, size_t n) {
+            if (n == 0)
+                return 0;
+
+            size_t pos = dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                // count consecutive slots that are written in this lap
+                size_t k = 0;
+                for (; k < n && k < N; ++k) {
+                    auto seq = slots[(pos + k) & mask].sequence.load(std::memory_order_acquire);
+                    if (seq != pos + k + 1) break;
+                }
+
+                if (k == 0) {
+                    auto seq = slots[pos & mask].sequence.load(std::memory_order_acquire);
+                    if (intptr_t(seq) - intptr_t(pos + 1) < 0)
+                        return 0; // empty
+                    pos = dequeuePos.load(std::memory_order_relaxed); // another consumer took it
+                    continue;
+                }
+
+                if (dequeuePos.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                    for (size_t i = 0; i < k; ++i)
+                        release_(slots[(pos + i) & mask], pos + i, dest[i]);
+                    return k;
+                }
+            }
+        }
+
+    private:
+        /// move the item out and mark the slot free for the next lap
+        static void release_(Slot& slot, size_t pos, T& item) {
+            item = etl::move(*slot.item());
+            slot.item()->~T();
+            slot.sequence.store(pos + N, std::memory_order_release);
+        }
+    };
+}
+
+#endif //ETL_MPMC_QUEUE_H
@@ -0,0 +1,353 @@
+#ifndef ETL_PRIORITY_QUEUE_H
+#define ETL_PRIORITY_QUEUE_H
+
+#include "etl/vector.h"
+
+namespace Project::etl::detail {
+
+    /// move the item held aside towards the root, starting from the hole at index i and stopping at index top.
+    /// the parents are moved down into the hole, moved(i) is invoked for every filled index
+    template <size_t D, typename Iterator, typename T, typename Compare, typename F> void
+    heap_push_hole(Iterator first, size_t i, size_t top, T&& value, Compare& comp, F&& moved) {
+        while (i > top) {
+            const size_t parent = (i - 1) / D;
+            if (!comp(first[parent], value)) break;
+            first[i] = etl::move(first[parent]);
+            moved(i);
+            i = parent;
+        }
+        first[i] = etl::forward<T>(value);
+        moved(i);
+    }
+
+    /// move the item at index i towards the root while its parent has lower priority
+    template <size_t D, typename Iterator, typename Compare, typename F> void
+    heap_sift_up(Iterator first, size_t i, Compare& comp, F&& moved) {
+        auto value = etl::move(first[i]);
+        heap_push_hole<D>(first, i, 0, etl::move(value), comp, moved);
+    }
+
+    /// move the item at index i towards the leaves while one of its D children has higher priority.
+    /// the hole is first moved down to a leaf along the children with the highest priority, then the item is
+    /// sifted up from there, it usually belongs near the leaves so this saves one comparison per level
+    template <size_t D, typename Iterator, typename Compare, typename F> void
+    heap_sift_down(Iterator first, size_t i, size_t n, Compare& comp, F&& moved) {
+        const size_t top = i;
+        auto value = etl::move(first[i]);
+        for (size_t child = D * i + 1; child < n; child = D * i + 1) {
+            size_t best = child;
+            const size_t last = etl::min(child + D, n);
+            for (size_t c = child + 1; c < last; ++c)
+                if (comp(first[best], first[c])) best = c;
+
+            first[i] = etl::move(first[best]);
+            moved(i);
+            i = best;
+        }
+        heap_push_hole<D>(first, i, top, etl::move(value), comp, moved);
+    }
+
+    /// arrange n items into a D-ary heap in O(n) by sifting down every internal node, last one first
+    template <size_t D, typename Iterator, typename Compare, typename F> void
+    heap_build(Iterator first, size_t n, Compare& comp, F&& moved) {
+        if (n < 2) return;
+        for (size_t i = (n - 2) / D + 1; i-- > 0;)
+            heap_sift_down<D>(first, i, n, comp, moved);
+    }
+}
+
+namespace Project::etl {
+
+    /// D-ary heap, the item with the highest priority according to Compare is on top.
+    /// with the default etl::Less the greatest item is on top, use etl::Greater for a min-heap
+    /// @tparam Container contiguous container with emplace_back() and resize(), e.g. Vector, SmallVector or StaticVector
+    /// @tparam D number of children per node, 4 halves the depth and keeps the children of a node on one cache line
+    template <typename T, typename Compare = etl::Less, typename Container = etl::Vector<T>, size_t D = 2>
+    class PriorityQueue {
+        static_assert(D >= 2, "the heap needs at least 2 children per node");
+
+        Container items;
+        Compare comp;
+
+        static constexpr auto unused_ = [](size_t) {};
+
+    public:
+        typedef T value_type;
+        typedef Container container_type;
+        typedef const T* const_iterator;
+
+        /// empty constructor
+        PriorityQueue() : items(), comp() {}
+
+        /// construct with a comparison object
+        explicit PriorityQueue(Compare comp) : items(), comp(etl::move(comp)) {}
+
+        /// take the items of a container and arrange them into a heap in O(n)
+        explicit PriorityQueue(Container container, Compare comp = {}) : items(etl::move(container)), comp(etl::move(comp)) {
+            detail::heap_build<D>(etl::begin(items), len(), this->comp, unused_);
+        }
+
+        /// construct from initializer list in O(n)
+        PriorityQueue(std::initializer_list<T>&& values) : PriorityQueue() {
+            for (auto& it : values) items.emplace_back(etl::move(it));
+            detail::heap_build<D>(etl::begin(items), len(), comp, unused_);
+        }
+
+        [[nodiscard]] size_t len() const { return etl::len(items); } ///< returns the number of items
+
+        /// return true if not empty
+        explicit operator bool() const { return len() > 0; }
+
+        /// items in heap order, only the first one is guaranteed to be the top
+        const_iterator begin() const { return etl::begin(items); }
+        const_iterator end()   const { return begin() + len(); }
+
+        /// underlying container in heap order
+        const Container& container() const { return items; }
+
+        /// get the item with the highest priority
+        /// @warning make sure the queue is not empty
+        const T& top() const { return *begin(); }
+
+        /// push operator
+        template <typename U>
+        PriorityQueue& operator<<(U&& item) { push(etl::forward<U>(item)); return *this; }
+
+        /// pop operator
+        PriorityQueue& operator>>(T& item) { pop(item); return *this; }
+
+        /// construct an item in place and restore the heap order in O(log n)
+        /// @return 0: the container can't grow, 1: success
+        template <typename... Args>
+        int emplace(Args&&... args) {
+            if (!items.emplace_back(etl::forward<Args>(args)...))
+                return 0;
+            detail::heap_sift_up<D>(etl::begin(items), len() - 1, comp, unused_);
+            return 1;
+        }
+
+        /// push an item and restore the heap order in O(log n)
+        /// @return 0: the container can't grow, 1: success
+        template <typename U>
+        int push(U&& item) { return emplace(etl::forward<U>(item)); }
+
+        /// add all items in range [first, last) and rebuild the heap once in O(n)
+        /// @return number of added items
+        template <typename Iterator, typename = enable_if_t<etl::is_iterator_v<Iterator>>>
+        size_t heapify(Iterator first, Iterator last) {
+            size_t n = 0;
+            for (; first != last && items.emplace_back(*first); ++first) ++n;
+            detail::heap_build<D>(etl::begin(items), len(), comp, unused_);
+            return n;
+        }
+
+        /// add all items of a sequence and rebuild the heap once in O(n)
+        /// @return number of added items
+        template <typename Sequence, typename = enable_if_t<!etl::is_iterator_v<Sequence>>>
+        size_t heapify(const Sequence& seq) { return heapify(etl::begin(seq), etl::end(seq)); }
+
+        /// removes the top item
+        /// @return 0: the queue is empty, 1: success
+        int pop() {
+            const size_t n = len();
+            if (n == 0)
+                return 0;
+
+            auto first = etl::begin(items);
+            if (n > 1) first[0] = etl::move(first[n - 1]);
+            items.resize(n - 1);
+            if (n > 2) detail::heap_sift_down<D>(first, 0, n - 1, comp, unused_);
+            return 1;
+        }
+
+        /// removes the top item and retrieves its value
+        /// @return 0: the queue is empty, 1: success
+        int pop(T& item) {
+            if (len() == 0)
+                return 0;
+            item = etl::move(*etl::begin(items));
+            return pop();
+        }
+
+        /// delete all items
+        void clear() { items.clear(); }
+
+        /// set the capacity of the underlying container
+        bool reserve(size_t capacity) { return items.reserve(capacity); }
+    };
+
+    /// D-ary heap where every pushed item gets a handle that stays valid until the item is removed,
+    /// so the priority of an item can be changed or the item removed without searching.
+    /// the heap stores the handles next to the items and a table maps each handle to its position in the heap
+    template <typename T, typename Compare = etl::Less, size_t D = 2>
+    class IndexedPriorityQueue {
+        static_assert(D >= 2, "the heap needs at least 2 children per node");
+
+        struct Entry {
+            T value;
+            size_t handle;
+        };
+
+        etl::Vector<Entry> heap;
+        etl::Vector<size_t> positions;  ///< position in the heap of each handle, npos if the handle is free
+        etl::Vector<size_t> freed;      ///< handles that can be reused
+        Compare comp;
+
+    public:
+        typedef T value_type;
+        typedef size_t handle_type;
+
+        static constexpr size_t npos = size_t(-1);
+
+        /// empty constructor
+        IndexedPriorityQueue() : heap(), positions(), freed(), comp() {}
+
+        /// construct with a comparison object
+        explicit IndexedPriorityQueue(Compare comp) : heap(), positions(), freed(), comp(etl::move(comp)) {}
+
+        [[nodiscard]] size_t len() const { return heap.len(); } ///< returns the number of items
+
+        /// return true if not empty
+        explicit operator bool() const { return len() > 0; }
+
+        /// get the item with the highest priority
+        /// @warning make sure the queue is not empty
+        const T& top() const { return heap.front().value; }
+
+        /// get the handle of the item with the highest priority
+        /// @warning make sure the queue is not empty
+        size_t top_handle() const { return heap.front().handle; }
+
+        /// return true if the handle refers to an item in the queue
+        bool contains(size_t handle) const { return handle < positions.len() && positions.begin()[handle] != npos; }
+
+        /// get an item by its handle
+        /// @warning it will be error null dereference if the handle is not valid
+        const T& get(size_t handle) const {
+            return contains(handle) ? heap.begin()[positions.begin()[handle]].value : *static_cast<const T*>(nullptr);
+        }
+
+        /// push an item and restore the heap order in O(log n)
+        /// @retval handle of the item, npos if the allocation fails
+        template <typename U>
+        size_t push(U&& value) {
+            const bool fresh = freed.len() == 0;
+            const size_t handle = fresh ? positions.len() : freed.back();
+            if (fresh) {
+                if (!positions.emplace_back(npos))
+                    return npos;
+                // keep a freed slot for every handle, so that remove never allocates
+                if (freed.size() < positions.len() && !freed.reserve(positions.size())) {
+                    positions.resize(handle);
+                    return npos;
+                }
+            }
+            if (!heap.emplace_back(Entry{ T(etl::forward<U>(value)), handle })) {
+                if (fresh) positions.resize(handle);
+                return npos;
+            }
+
+            if (!fresh) freed.resize(freed.len() - 1);
+            sift_up_(len() - 1);
+            return handle;
+        }
+
+        /// removes the top item
+        /// @return 0: the queue is empty, 1: success
+        int pop() { return len() ? remove(top_handle()) : 0; }
+
+        /// removes the top item and retrieves its value
+        /// @return 0: the queue is empty, 1: success
+        int pop(T& item) {
+            if (len() == 0)
+                return 0;
+            item = etl::move(heap.front().value);
+            return pop();
+        }
+
+        /// remove an item by its handle, the handle can be reused by later pushes
+        /// @return 0: invalid handle, 1: success
+        int remove(size_t handle) {
+            if (!contains(handle))
+                return 0;
+
+            const size_t i = positions.begin()[handle];
+            const size_t last = len() - 1;
+            positions.begin()[handle] = npos;
+            freed.emplace_back(handle); // the capacity is reserved by push
+
+            if (i != last) {
+                heap.begin()[i] = etl::move(heap.begin()[last]);
+                heap.resize(last);
+                restore_(i);
+            } else {
+                heap.resize(last);
+            }
+            return 1;
+        }
+
+        /// raise the priority of an item, i.e. decrease its key when the queue is a min-heap, in O(log n)
+        /// @return 0: invalid handle or the new value has lower priority, 1: success
+        template <typename U>
+        int decrease_key(size_t handle, U&& value) {
+            if (!contains(handle))
+                return 0;
+
+            auto& entry = heap.begin()[positions.begin()[handle]];
+            if (comp(value, entry.value))
+                return 0;
+
+            entry.value = etl::forward<U>(value);
+            sift_up_(positions.begin()[handle]);
+            return 1;
+        }
+
+        /// change the value of an item and restore the heap order in O(log n)
+        /// @return 0: invalid handle, 1: success
+        template <typename U>
+        int update(size_t handle, U&& value) {
+            if (!contains(handle))
+                return 0;
+
+            heap.begin()[positions.begin()[handle]].value = etl::forward<U>(value);
+            restore_(positions.begin()[handle]);
+            return 1;
+        }
+
+        /// delete all items and invalidate all handles
+        void clear() {
+            heap.clear();
+            positions.clear();
+            freed.clear();
+        }
+
+    private:
+        bool less_(const Entry& a, const Entry& b) { return comp(a.value, b.value); }
+
+        void sift_up_(size_t i) {
+            auto cmp = [this](const Entry& a, const Entry& b) { return less_(a, b); };
+            detail::heap_sift_up<D>(heap.begin(), i, cmp, [this](size_t k) { positions.begin()[heap.begin()[k].handle] = k; });
+        }
+
+        void sift_down_(size_t i) {
+            auto cmp = [this](const Entry& a, const Entry& b) { return less_(a, b); };
+            detail::heap_sift_down<D>(heap.begin(), i, len(), cmp, [this](size_t k) { positions.begin()[heap.begin()[k].handle] = k; });
+        }
+
+        /// move the item at index i up or down, whichever direction is out of order
+        void restore_(size_t i) {
+            if (i > 0 && less_(heap.begin()[(i - 1) / D], heap.begin()[i])) sift_up_(i);
+            else sift_down_(i);
+        }
+    };
+
+    /// type traits
+    template <typename T> struct is_priority_queue : false_type {};
+    template <typename T, typename C, typename S, size_t D> struct is_priority_queue<PriorityQueue<T, C, S, D>> : true_type {};
+    template <typename T, typename C, typename S, size_t D> struct is_priority_queue<const PriorityQueue<T, C, S, D>> : true_type {};
+    template <typename T, typename C, typename S, size_t D> struct is_priority_queue<volatile PriorityQueue<T, C, S, D>> : true_type {};
+    template <typename T, typename C, typename S, size_t D> struct is_priority_queue<const volatile PriorityQueue<T, C, S, D>> : true_type {};
+    template <typename T> inline constexpr bool is_priority_queue_v = is_priority_queue<T>::value;
+}
+
+#endif //ETL_PRIORITY_QUEUE_H
@@ -0,0 +1,780 @@
+#ifndef ETL_RADIX_TREE_H
+#define ETL_RADIX_TREE_H
+
+#include "etl/allocator.h"
+#include "etl/bit.h"
+#include "etl/string_view.h"
+#include "etl/tuple.h"
+#include <cstring> // memcmp, memcpy, memmove, memset
+#include <new>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/// number of bytes of a compressed path that are stored in a radix tree node,
+/// the rest of a longer path is read from the key of any leaf below the node
+#ifndef ETL_RADIX_PREFIX_SIZE
+#define ETL_RADIX_PREFIX_SIZE 8
+#endif
+
+namespace Project::etl {
+
+    /// ordered map from string keys to values, implemented as adaptive radix tree.
+    /// every inner node consumes one byte of the key after its compressed path, and grows or shrinks
+    /// between 4, 16, 48 and 256 children as needed. a key that ends at an inner node is stored in the node itself
+    /// @note the characters of the keys are not copied, they must outlive the tree
+    /// @note the keys are ordered by their unsigned bytes, a prefix comes before the longer keys
+    template <typename V, typename A = etl::Allocator<V>>
+    class RadixTree {
+        static constexpr size_t P = ETL_RADIX_PREFIX_SIZE;
+
+        struct Leaf {
+            StringView key;
+            V value;
+        };
+
+        /// reference to a child, either a node or a leaf tagged with the lowest bit
+        typedef uintptr_t Ref;
+
+        enum Type : uint8_t { N4, N16, N48, N256 };
+
+        struct Node {
+            Type type;
+            uint8_t prefix[P];  ///< first bytes of the compressed path
+            uint16_t n;         ///< number of children
+            uint32_t prefixLen; ///< length of the compressed path
+            Leaf* leaf;         ///< leaf whose key ends right after the compressed path
+        };
+
+        struct Node4 : Node { uint8_t keys[4]; Ref children[4]; };
+        struct Node16 : Node { alignas(16) uint8_t keys[16]; Ref children[16]; };
+        struct Node48 : Node { uint8_t index[256]; Ref children[48]; }; ///< index is position + 1, 0 if empty
+        struct Node256 : Node { Ref children[256]; };
+
+        Ref root = 0;
+        size_t nItems = 0;
+
+    public:
+        template <typename U>
+        class Iterator;
+
+        typedef StringView Key;
+        typedef V Value;
+        typedef Iterator<V> iterator;
+        typedef Iterator<const V> const_iterator;
+        typedef A Alloc;
+
+        /// empty constructor
+        constexpr RadixTree() {}
+
+        /// construct from initializer list, the characters of the keys must outlive the tree
+        RadixTree(std::initializer_list<Pair<StringView, V>>&& items) {
+            for (auto& it : items) insert(it.x, etl::move(it.y));
+        }
+
+        RadixTree(const RadixTree&) = delete;
+        RadixTree& operator=(const RadixTree&) = delete;
+
+        /// move constructor
+        RadixTree(RadixTree&& other) noexcept { *this = etl::move(other); }
+
+        /// move assignment, the nodes are stolen
+        RadixTree& operator=(RadixTree&& other) noexcept {
+            if (this == &other) return *this;
+            clear();
+            root = etl::exchange(other.root, 0);
+            nItems = etl::exchange(other.nItems, 0);
+            return *this;
+        }
+
+        /// destructor
+        ~RadixTree() { clear(); }
+
+        [[nodiscard]] size_t len() const { return nItems; } ///< returns the number of pairs
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        iterator begin() { return { this, seek_(root, "", 0, false), "" }; }
+        iterator end()   { return { this, nullptr, "" }; }
+
+        const_iterator begin() const { return { this, seek_(root, "", 0, false), "" }; }
+        const_iterator end()   const { return { this, nullptr, "" }; }
+
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// iterate the pairs whose key starts with the given prefix, in key order
+        /// @note the characters of the prefix must outlive the returned iter object
+        Iter<iterator> prefix(const StringView& p) { return Iter(iterator(this, prefix_first_(p), p), iterator(this, nullptr, p), 1); }
+        Iter<const_iterator> prefix(const StringView& p) const {
+            return Iter(const_iterator(this, prefix_first_(p), p), const_iterator(this, nullptr, p), 1);
+        }
+
+        /// find the pair with the longest key that is a prefix of the given text
+        /// @return iterator to the pair, end if no key is a prefix of the text
+        iterator longest_prefix(const StringView& text) { return { this, longest_prefix_(text), "" }; }
+        const_iterator longest_prefix(const StringView& text) const { return { this, longest_prefix_(text), "" }; }
+
+        /// check if a key is in this tree
+        bool has(const StringView& key) const { return find(key) != nullptr; }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        V& get(const StringView& key) { return *find(key); }
+        const V& get(const StringView& key) const { return *find(key); }
+
+        /// get a value given the key, a default value is inserted if the key doesn't exist
+        /// @warning it will throw error null dereference if allocation fails
+        V& operator[](const StringView& key) {
+            if (V* value = find(key)) return *value;
+            return *insert_leaf_(key);
+        }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        const V& operator[](const StringView& key) const { return *find(key); }
+
+        V* find(const StringView& key) {
+            Leaf* leaf = find_(key);
+            return leaf ? &leaf->value : nullptr;
+        }
+
+        const V* find(const StringView& key) const { return const_cast<RadixTree*>(this)->find(key); }
+
+        /// insert a key-value pair, the characters of the key are referenced, not copied
+        /// @return false if the key already exists or allocation fails
+        template <typename... Args>
+        bool emplace(const StringView& key, Args&&... args) {
+            return !find_(key) && insert_leaf_(key, etl::forward<Args>(args)...) != nullptr;
+        }
+
+        /// insert a key-value pair, the characters of the key are referenced, not copied
+        /// @return false if the key already exists or allocation fails
+        template <typename U>
+        bool insert(const StringView& key, U&& value) { return emplace(key, etl::forward<U>(value)); }
+
+        /// remove a key
+        /// @return false if the key doesn't exist
+        bool remove(const StringView& key) {
+            if (!remove_(root, key, 0)) return false;
+            --nItems;
+            return true;
+        }
+
+        /// remove all pairs
+        void clear() {
+            destroy_(root);
+            root = 0;
+            nItems = 0;
+        }
+
+    private:
+        static bool is_leaf_(Ref ref) { return ref & 1u; }
+        static Leaf* leaf_(Ref ref) { return reinterpret_cast<Leaf*>(ref & ~Ref(1)); }
+        static Node* node_(Ref ref) { return reinterpret_cast<Node*>(ref); }
+        static Ref ref_(Leaf* leaf) { return reinterpret_cast<Ref>(leaf) | 1u; }
+        static Ref ref_(Node* node) { return reinterpret_cast<Ref>(node); }
+
+        static uint8_t byte_(const StringView& key, size_t i) { return uint8_t(key.data()[i]); }
+
+        static Leaf* allocate_leaf_() {
+            etl::allocator_rebind_t<A, Leaf> alloc;
+            return alloc.allocate(1);
+        }
+
+        static void destroy_leaf_(Leaf* leaf) {
+            leaf->~Leaf();
+            etl::allocator_rebind_t<A, Leaf> alloc;
+            alloc.deallocate(leaf, 1);
+        }
+
+        /// allocate a node with no children, copying the path and the leaf of another node if given
+        template <typename T>
+        static T* new_node_(Type type, const Node* from = nullptr) {
+            etl::allocator_rebind_t<A, T> alloc;
+            T* res = alloc.allocate(1);
+            if (res == nullptr) return nullptr;
+            ::memset(static_cast<void*>(res), 0, sizeof(T));
+            if (from) static_cast<Node&>(*res) = *from;
+            res->type = type;
+            res->n = 0;
+            return res;
+        }
+
+        template <typename T>
+        static void deallocate_(T* p) {
+            etl::allocator_rebind_t<A, T> alloc;
+            alloc.deallocate(p, 1);
+        }
+
+        static void deallocate_node_(Node* node) {
+            switch (node->type) {
+                case N4: return deallocate_(static_cast<Node4*>(node));
+                case N16: return deallocate_(static_cast<Node16*>(node));
+                case N48: return deallocate_(static_cast<Node48*>(node));
+                default: return deallocate_(static_cast<Node256*>(node));
+            }
+        }
+
+        template <typename F>
+        static void foreach_child_(Node* node, F&& fn) {
+            switch (node->type) {
+                case N4: {
+                    auto n4 = static_cast<Node4*>(node);
+                    for (int i = 0; i < n4->n; ++i) fn(n4->children[i]);
+                    return;
+                }
+                case N16: {
+                    auto n16 = static_cast<Node16*>(node);
+                    for (int i = 0; i < n16->n; ++i) fn(n16->children[i]);
+                    return;
+                }
+                case N48: {
+                    auto n48 = static_cast<Node48*>(node);
+                    for (int i = 0; i < 48; ++i) if (n48->children[i]) fn(n48->children[i]);
+                    return;
+                }
+                default: {
+                    auto n256 = static_cast<Node256*>(node);
+                    for (int i = 0; i < 256; ++i) if (n256->children[i]) fn(n256->children[i]);
+                    return;
+                }
+            }
+        }
+
+        static void destroy_(Ref ref) {
+            if (ref == 0) return;
+            if (is_leaf_(ref)) return destroy_leaf_(leaf_(ref));
+
+            Node* node = node_(ref);
+            if (node->leaf) destroy_leaf_(node->leaf);
+            foreach_child_(node, [](Ref child) { destroy_(child); });
+            deallocate_node_(node);
+        }
+
+        /// pointer to the child for a byte, null if there is none
+        static Ref* find_child_(Node* node, uint8_t c) {
+            switch (node->type) {
+                case N4: {
+                    auto n4 = static_cast<Node4*>(node);
+                    for (int i = 0; i < n4->n; ++i) if (n4->keys[i] == c) return &n4->children[i];
+                    return nullptr;
+                }
+                case N16: {
+                    auto n16 = static_cast<Node16*>(node);
+#if defined(__SSE2__)
+                    const __m128i keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(n16->keys));
+                    const uint32_t eq = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(c)), keys)));
+                    const uint32_t mask = eq & ((1u << n16->n) - 1u);
+                    return mask ? &n16->children[etl::count_trailing_zeros(mask)] : nullptr;
+#else
+                    for (int i = 0; i < n16->n; ++i) if (n16->keys[i] == c) return &n16->children[i];
+                    return nullptr;
+#endif
+                }
+                case N48: {
+                    auto n48 = static_cast<Node48*>(node);
+                    return n48->index[c] ? &n48->children[n48->index[c] - 1] : nullptr;
+                }
+                default: {
+                    auto n256 = static_cast<Node256*>(node);
+                    return n256->children[c] ? &n256->children[c] : nullptr;
+                }
+            }
+        }
+
+        /// first child with a byte greater than c, 0 if there is none
+        static Ref next_child_(Node* node, uint8_t c) {
+            switch (node->type) {
+                case N4: {
+                    auto n4 = static_cast<Node4*>(node);
+                    for (int i = 0; i < n4->n; ++i) if (n4->keys[i] > c) return n4->children[i];
+                    return 0;
+                }
+                case N16: {
+                    auto n16 = static_cast<Node16*>(node);
+                    for (int i = 0; i < n16->n; ++i) if (n16->keys[i] > c) return n16->children[i];
+                    return 0;
+                }
+                case N48: {
+                    auto n48 = static_cast<Node48*>(node);
+                    for (int i = c + 1; i < 256; ++i) if (n48->index[i]) return n48->children[n48->index[i] - 1];
+                    return 0;
+                }
+                default: {
+                    auto n256 = static_cast<Node256*>(node);
+                    for (int i = c + 1; i < 256; ++i) if (n256->children[i]) return n256->children[i];
+                    return 0;
+                }
+            }
+        }
+
+        /// child with the smallest byte, 0 if there is none
+        static Ref first_child_(Node* node) {
+            if (node->type == N4) return node->n ? static_cast<Node4*>(node)->children[0] : 0;
+            if (node->type == N16) return node->n ? static_cast<Node16*>(node)->children[0] : 0;
+            Ref* child = find_child_(node, 0);
+            return child ? *child : next_child_(node, 0);
+        }
+
+        /// insert a child into the sorted keys of a node with 4 or 16 children
+        static void insert_sorted_(uint8_t* keys, Ref* children, uint16_t& n, uint8_t c, Ref child) {
+            int i = n;
+            for (; i > 0 && keys[i - 1] > c; --i) {
+                keys[i] = keys[i - 1];
+                children[i] = children[i - 1];
+            }
+            keys[i] = c;
+            children[i] = child;
+            ++n;
+        }
+
+        /// add a child for a byte that has none, the node grows if it is full
+        /// @return false if allocation fails
+        static bool add_child_(Ref& ref, uint8_t c, Ref child) {
+            Node* node = node_(ref);
+            if (node->type == N4) {
+                auto n4 = static_cast<Node4*>(node);
+                if (n4->n < 4) {
+                    insert_sorted_(n4->keys, n4->children, n4->n, c, child);
+                    return true;
+                }
+
+                auto n16 = new_node_<Node16>(N16, n4);
+                if (n16 == nullptr) return false;
+                ::memcpy(n16->keys, n4->keys, 4);
+                ::memcpy(n16->children, n4->children, 4 * sizeof(Ref));
+                n16->n = 4;
+                deallocate_(n4);
+                ref = ref_(n16);
+                node = n16;
+            }
+
+            if (node->type == N16) {
+                auto n16 = static_cast<Node16*>(node);
+                if (n16->n < 16) {
+                    insert_sorted_(n16->keys, n16->children, n16->n, c, child);
+                    return true;
+                }
+
+                auto n48 = new_node_<Node48>(N48, n16);
+                if (n48 == nullptr) return false;
+                for (int i = 0; i < 16; ++i) {
+                    n48->index[n16->keys[i]] = uint8_t(i + 1);
+                    n48->children[i] = n16->children[i];
+                }
+                n48->n = 16;
+                deallocate_(n16);
+                ref = ref_(n48);
+                node = n48;
+            }
+
+            if (node->type == N48) {
+                auto n48 = static_cast<Node48*>(node);
+                if (n48->n < 48) {
+                    int i = 0;
+                    while (n48->children[i]) ++i;
+                    n48->children[i] = child;
+                    n48->index[c] = uint8_t(i + 1);
+                    ++n48->n;
+                    return true;
+                }
+
+                auto n256 = new_node_<Node256>(N256, n48);
+                if (n256 == nullptr) return false;
+                for (int i = 0; i < 256; ++i) if (n48->index[i]) n256->children[i] = n48->children[n48->index[i] - 1];
+                n256->n = 48;
+                deallocate_(n48);
+                ref = ref_(n256);
+                node = n256;
+            }
+
+            auto n256 = static_cast<Node256*>(node);
+            n256->children[c] = child;
+            ++n256->n;
+            return true;
+        }
+
+        static void remove_child_(Node* node, uint8_t c) {
+            if (node->type == N4 || node->type == N16) {
+                uint8_t* keys = node->type == N4 ? static_cast<Node4*>(node)->keys : static_cast<Node16*>(node)->keys;
+                Ref* children = node->type == N4 ? static_cast<Node4*>(node)->children : static_cast<Node16*>(node)->children;
+                int i = 0;
+                while (keys[i] != c) ++i;
+                for (--node->n; i < node->n; ++i) {
+                    keys[i] = keys[i + 1];
+                    children[i] = children[i + 1];
+                }
+            } else if (node->type == N48) {
+                auto n48 = static_cast<Node48*>(node);
+                n48->children[n48->index[c] - 1] = 0;
+                n48->index[c] = 0;
+                --n48->n;
+            } else {
+                static_cast<Node256*>(node)->children[c] = 0;
+                --node->n;
+            }
+        }
+
+        /// replace a node by a smaller one when it has few children, or by its only entry.
+        /// the node type shrinks below the size it grows at, so a key that is added and removed repeatedly
+        /// doesn't reallocate the node every time
+        static void shrink_(Ref& ref, size_t depth) {
+            Node* node = node_(ref);
+            if (node->type == N4) {
+                auto n4 = static_cast<Node4*>(node);
+                if (n4->n + (n4->leaf != nullptr) > 1) return;
+
+                if (n4->leaf) {
+                    ref = ref_(n4->leaf);
+                } else {
+                    // the path of the only child is extended by the path of this node and the byte that selects the child
+                    ref = n4->children[0];
+                    if (!is_leaf_(ref)) {
+                        Node* child = node_(ref);
+                        set_path_(child, min_leaf_(ref)->key.data() + depth, n4->prefixLen + 1 + child->prefixLen);
+                    }
+                }
+                deallocate_(n4);
+            }
+            else if (node->type == N16 && node->n <= 3) {
+                auto n16 = static_cast<Node16*>(node);
+                auto n4 = new_node_<Node4>(N4, n16);
+                if (n4 == nullptr) return;
+                ::memcpy(n4->keys, n16->keys, n16->n);
+                ::memcpy(n4->children, n16->children, n16->n * sizeof(Ref));
+                n4->n = n16->n;
+                deallocate_(n16);
+                ref = ref_(n4);
+            }
+            else if (node->type == N48 && node->n <= 12) {
+                auto n48 = static_cast<Node48*>(node);
+                auto n16 = new_node_<Node16>(N16, n48);
+                if (n16 == nullptr) return;
+                for (int i = 0; i < 256; ++i) if (n48->index[i]) {
+                    n16->keys[n16->n] = uint8_t(i);
+                    n16->children[n16->n++] = n48->children[n48->index[i] - 1];
+                }
+                deallocate_(n48);
+                ref = ref_(n16);
+            }
+            else if (node->type == N256 && node->n <= 37) {
+                auto n256 = static_cast<Node256*>(node);
+                auto n48 = new_node_<Node48>(N48, n256);
+                if (n48 == nullptr) return;
+                for (int i = 0; i < 256; ++i) if (n256->children[i]) {
+                    n48->children[n48->n++] = n256->children[i];
+                    n48->index[i] = uint8_t(n48->n);
+                }
+                deallocate_(n256);
+                ref = ref_(n48);
+            }
+        }
+
+        /// leaf with the smallest key below a reference
+        static Leaf* min_leaf_(Ref ref) {
+            while (!is_leaf_(ref)) {
+                Node* node = node_(ref);
+                if (node->leaf) return node->leaf;
+                ref = first_child_(node);
+            }
+            return leaf_(ref);
+        }
+
+        static void set_path_(Node* node, const char* path, size_t len) {
+            node->prefixLen = uint32_t(len);
+            ::memcpy(node->prefix, path, etl::min(len, P));
+        }
+
+        /// byte i of the compressed path of a node at the given depth
+        static uint8_t path_byte_(Node* node, size_t depth, size_t i) {
+            return i < P ? node->prefix[i] : byte_(min_leaf_(ref_(node))->key, depth + i);
+        }
+
+        /// number of bytes of the compressed path of a node that match the key from the given depth
+        static size_t path_match_(Node* node, const StringView& key, size_t depth) {
+            const size_t n = etl::min(size_t(node->prefixLen), key.len() - depth);
+            size_t i = 0;
+            for (; i < n && i < P; ++i) if (node->prefix[i] != byte_(key, depth + i)) return i;
+            if (i < n) {
+                const char* path = min_leaf_(ref_(node))->key.data() + depth;
+                for (; i < n; ++i) if (path[i] != key.data()[depth + i]) return i;
+            }
+            return i;
+        }
+
+        static size_t common_len_(const StringView& a, const StringView& b, size_t depth) {
+            const size_t n = etl::min(a.len(), b.len());
+            size_t i = depth;
+            while (i < n && a.data()[i] == b.data()[i]) ++i;
+            return i - depth;
+        }
+
+        /// compare the unsigned bytes, a prefix is less than the longer key
+        static int compare_(const StringView& a, const StringView& b) {
+            const size_t n = etl::min(a.len(), b.len());
+            const int res = n ? ::memcmp(a.data(), b.data(), n) : 0;
+            if (res != 0) return res;
+            return a.len() < b.len() ? -1 : a.len() > b.len() ? 1 : 0;
+        }
+
+        static bool starts_with_(const StringView& text, const StringView& p) {
+            return text.len() >= p.len() && (p.len() == 0 || ::memcmp(text.data(), p.data(), p.len()) == 0);
+        }
+
+        /// the compressed paths are skipped without comparing them, the key is compared once at the leaf
+        Leaf* find_(const StringView& key) const {
+            Ref ref = root;
+            size_t depth = 0;
+            while (ref != 0) {
+                if (is_leaf_(ref)) return compare_(leaf_(ref)->key, key) == 0 ? leaf_(ref) : nullptr;
+
+                Node* node = node_(ref);
+                depth += node->prefixLen;
+                if (depth > key.len()) return nullptr;
+                if (depth == key.len()) return node->leaf && compare_(node->leaf->key, key) == 0 ? node->leaf : nullptr;
+
+                Ref* child = find_child_(node, byte_(key, depth++));
+                ref = child ? *child : 0;
+            }
+            return nullptr;
+        }
+
+        /// the keys ending at the nodes along the path of the text are the candidates, from the shortest to the longest
+        Leaf* longest_prefix_(const StringView& text) const {
+            Leaf* res = nullptr;
+            Ref ref = root;
+            size_t depth = 0;
+            while (ref != 0) {
+                if (is_leaf_(ref)) return starts_with_(text, leaf_(ref)->key) ? leaf_(ref) : res;
+
+                Node* node = node_(ref);
+                depth += node->prefixLen;
+                if (depth > text.len()) break;
+                if (node->leaf) {
+                    // if this key doesn't match, the path of the node doesn't match either
+                    if (!starts_with_(text, node->leaf->key)) break;
+                    res = node->leaf;
+                }
+                if (depth == text.len()) break;
+
+                Ref* child = find_child_(node, byte_(text, depth++));
+                ref = child ? *child : 0;
+            }
+            return res;
+        }
+
+        /// leaf with the smallest key that is not less than the given key, or greater if strict
+        static Leaf* seek_(Ref ref, const StringView& key, size_t depth, bool strict) {
+            if (ref == 0) return nullptr;
+            if (is_leaf_(ref)) {
+                const int cmp = compare_(leaf_(ref)->key, key);
+                return cmp > 0 || (cmp == 0 && !strict) ? leaf_(ref) : nullptr;
+            }
+
+            Node* node = node_(ref);
+            const size_t m = path_match_(node, key, depth);
+            if (m < node->prefixLen) {
+                // every key below is greater if the key ends inside the path or has a smaller byte
+                const bool greater = depth + m == key.len() || path_byte_(node, depth, m) > byte_(key, depth + m);
+                return greater ? min_leaf_(ref) : nullptr;
+            }
+
+            depth += node->prefixLen;
+            if (depth == key.len()) {
+                if (node->leaf && !strict) return node->leaf;
+                const Ref first = first_child_(node);
+                return first ? min_leaf_(first) : nullptr;
+            }
+
+            const uint8_t c = byte_(key, depth);
+            if (Ref* child = find_child_(node, c)) {
+                if (Leaf* res = seek_(*child, key, depth + 1, strict)) return res;
+            }
+            const Ref next = next_child_(node, c);
+            return next ? min_leaf_(next) : nullptr;
+        }
+
+        /// first leaf whose key starts with the given prefix
+        Leaf* prefix_first_(const StringView& p) const {
+            Leaf* leaf = seek_(root, p, 0, false);
+            return leaf && starts_with_(leaf->key, p) ? leaf : nullptr;
+        }
+
+        template <typename... Args>
+        V* insert_leaf_(const StringView& key, Args&&... args) {
+            Leaf* leaf = allocate_leaf_();
+            if (leaf == nullptr) return nullptr;
+            new(&leaf->key) StringView(key);
+            new(&leaf->value) V(etl::forward<Args>(args)...);
+
+            if (!insert_(root, key, 0, leaf)) {
+                destroy_leaf_(leaf);
+                return nullptr;
+            }
+            ++nItems;
+            return &leaf->value;
+        }
+
+        /// insert a leaf whose key doesn't exist yet
+        /// @return false if allocation fails
+        static bool insert_(Ref& ref, const StringView& key, size_t depth, Leaf* leaf) {
+            if (ref == 0) {
+                ref = ref_(leaf);
+                return true;
+            }
+
+            if (is_leaf_(ref)) {
+                // both leaves go below a new node whose path is their common prefix
+                Leaf* other = leaf_(ref);
+                const size_t n = common_len_(other->key, key, depth);
+                auto node = new_node_<Node4>(N4);
+                if (node == nullptr) return false;
+
+                set_path_(node, key.data() + depth, n);
+                depth += n;
+                Ref res = ref_(node);
+                for (Leaf* l : {other, leaf}) {
+                    if (l->key.len() == depth) node->leaf = l;
+                    else add_child_(res, byte_(l->key, depth), ref_(l));
+                }
+                ref = res;
+                return true;
+            }
+
+            Node* node = node_(ref);
+            const size_t m = path_match_(node, key, depth);
+            if (m < node->prefixLen) {
+                // the path is split by a new parent node at the first mismatch
+                auto parent = new_node_<Node4>(N4);
+                if (parent == nullptr) return false;
+
+                const char* path = min_leaf_(ref)->key.data() + depth;
+                const uint8_t c = path_byte_(node, depth, m);
+                const size_t rest = node->prefixLen - m - 1;
+                set_path_(parent, key.data() + depth, m);
+                if (node->prefixLen <= P) ::memmove(node->prefix, node->prefix + m + 1, rest);
+                else ::memcpy(node->prefix, path + m + 1, etl::min(rest, P));
+                node->prefixLen = uint32_t(rest);
+
+                Ref res = ref_(parent);
+                add_child_(res, c, ref);
+                if (depth + m == key.len()) parent->leaf = leaf;
+                else add_child_(res, byte_(key, depth + m), ref_(leaf));
+                ref = res;
+                return true;
+            }
+
+            depth += node->prefixLen;
+            if (depth == key.len()) {
+                node->leaf = leaf;
+                return true;
+            }
+
+            const uint8_t c = byte_(key, depth);
+            if (Ref* child = find_child_(node, c)) return insert_(*child, key, depth + 1, leaf);
+            return add_child_(ref, c, ref_(leaf));
+        }
+
+        static bool remove_(Ref& ref, const StringView& key, size_t depth) {
+            if (ref == 0) return false;
+            if (is_leaf_(ref)) {
+                if (compare_(leaf_(ref)->key, key) != 0) return false;
+                destroy_leaf_(leaf_(ref));
+                ref = 0;
+                return true;
+            }
+
+            Node* node = node_(ref);
+            const size_t start = depth;
+            if (path_match_(node, key, depth) < node->prefixLen) return false;
+
+            depth += node->prefixLen;
+            if (depth == key.len()) {
+                if (node->leaf == nullptr || compare_(node->leaf->key, key) != 0) return false;
+                destroy_leaf_(node->leaf);
+                node->leaf = nullptr;
+                shrink_(ref, start);
+                return true;
+            }
+
+            const uint8_t c = byte_(key, depth);
+            Ref* child = find_child_(node, c);
+            if (child == nullptr) return false;
+            if (!is_leaf_(*child)) return remove_(*child, key, depth + 1);
+
+            if (compare_(leaf_(*child)->key, key) != 0) return false;
+            destroy_leaf_(leaf_(*child));
+            remove_child_(node, c);
+            shrink_(ref, start);
+            return true;
+        }
+    };
+
+    /// iterates the pairs in key order, every step seeks the next key from the root,
+    /// dereferencing yields a pair of references to the key and the value
+    template <typename V, typename A>
+    template <typename U>
+    class RadixTree<V, A>::Iterator {
+        friend class RadixTree<V, A>;
+        const RadixTree* tree;
+        Leaf* leaf;
+        StringView prefix; ///< the iteration ends at the first key that doesn't start with it
+
+        Iterator(const RadixTree* tree, Leaf* leaf, const StringView& prefix) : tree(tree), leaf(leaf), prefix(prefix) {}
+
+    public:
+        /// empty constructor
+        Iterator() : tree(nullptr), leaf(nullptr) {}
+
+        Pair<const StringView&, U&> operator*() const { return { leaf->key, leaf->value }; }
+
+        const StringView& key() const { return leaf->key; }
+        U& value() const { return leaf->value; }
+
+        bool operator==(const Iterator& other) const { return leaf == other.leaf; }
+        bool operator!=(const Iterator& other) const { return leaf != other.leaf; }
+
+        Iterator& operator++() {
+            leaf = seek_(tree->root, leaf->key, 0, true);
+            if (leaf && !starts_with_(leaf->key, prefix)) leaf = nullptr;
+            return *this;
+        }
+
+        Iterator operator++(int) { auto res = *this; ++*this; return res; } // NOLINT
+
+        /// distance to a preceding iterator, it steps over the keys in between
+        size_t operator-(const Iterator& other) const {
+            size_t res = 0;
+            for (Iterator it = other; it != *this; ++it) ++res;
+            return res;
+        }
+    };
+
+    /// create empty radix tree
+    template <typename V, typename A = etl::Allocator<V>> constexpr auto
+    radix_tree() { return RadixTree<V, A> {}; }
+
+    /// create radix tree from initializer list, type is explicitly specified
+    template <typename V, typename A = etl::Allocator<V>> auto
+    radix_tree(std::initializer_list<Pair<StringView, V>>&& items) { return RadixTree<V, A>(etl::move(items)); }
+
+    /// type traits
+    template <typename T> struct is_radix_tree : false_type {};
+    template <typename V, typename A> struct is_radix_tree<RadixTree<V, A>> : true_type {};
+    template <typename V, typename A> struct is_radix_tree<const RadixTree<V, A>> : true_type {};
+    template <typename V, typename A> struct is_radix_tree<volatile RadixTree<V, A>> : true_type {};
+    template <typename V, typename A> struct is_radix_tree<const volatile RadixTree<V, A>> : true_type {};
+    template <typename T> inline constexpr bool is_radix_tree_v = is_radix_tree<T>::value;
+
+    template <typename V, typename A> struct is_trivially_relocatable<RadixTree<V, A>> : true_type {};
+
+    template <typename V, typename A> struct remove_extent<RadixTree<V, A>> { typedef V type; };
+    template <typename V, typename A> struct remove_extent<const RadixTree<V, A>> { typedef V type; };
+    template <typename V, typename A> struct remove_extent<volatile RadixTree<V, A>> { typedef V type; };
+    template <typename V, typename A> struct remove_extent<const volatile RadixTree<V, A>> { typedef V type; };
+}
+
+#endif //ETL_RADIX_TREE_H
@@ -25,7 +25,19 @@ namespace Project::etl {
 
         constexpr Range reversed() const { return Range(stop - step, start - step, -step); }
 
-        constexpr size_t len() const { return operator bool() ? (stop - start) / step : 0; }
+        /// number of items, the last step may end before stop, e.g. range(1, 6, 2) has 3 items
+        constexpr size_t len() const {
+            if (!operator bool()) return 0;
+            if constexpr (etl::is_floating_point_v<T>) {
+                const auto n = size_t((stop - start) / step);
+                return start + T(n) * step == stop ? n : n + 1;
+            } else {
+                // distance and step magnitude as size_t, so that unsigned ranges with a negative step are counted too
+                const auto distance = size_t(step > U(0) ? stop - start : start - stop);
+                const auto stride = size_t(step > U(0) ? step : -step);
+                return distance / stride + (distance % stride != 0);
+            }
+        }
 
         constexpr T operator[](int index) const {
             auto n = int(len());
@@ -2,8 +2,8 @@
 #define ETL_RESULT_H
 
 #include "etl/optional.h"
+#include "etl/variant.h"
 #include <tuple>
-#include <variant>
 
 namespace Project::etl {
     /// Represents a variant type that holds an ok value. the type can be void
@@ -95,51 +95,51 @@ namespace Project::etl {
         constexpr bool is_err() const { return variant.index() == 2; }
 
         /// unwrap ok value
-        constexpr T& unwrap() & { return std::get<Ok<T>>(variant).data; }
+        constexpr T& unwrap() & { return variant.template get<Ok<T>>().data; }
 
         /// unwrap ok value
-        constexpr T&& unwrap() && { return etl::move(std::get<Ok<T>>(variant).data); }
+        constexpr T&& unwrap() && { return etl::move(variant.template get<Ok<T>>().data); }
         
         /// unwrap ok value
-        constexpr const T& unwrap() const& { return std::get<Ok<T>>(variant).data; }
+        constexpr const T& unwrap() const& { return variant.template get<Ok<T>>().data; }
 
         /// unwrap ok value
-        constexpr const T&& unwrap() const&& { return etl::move(std::get<Ok<T>>(variant).data); }
+        constexpr const T&& unwrap() const&& { return etl::move(variant.template get<Ok<T>>().data); }
 
         /// unwrap ok value or return default value
         template <typename U>
         constexpr T unwrap_or(U&& value) && { 
-            return variant.index() == 1 ? etl::move(std::get<Ok<T>>(variant).data) : static_cast<T>(etl::forward<U>(value)); 
+            return variant.index() == 1 ? etl::move(variant.template get<Ok<T>>().data) : static_cast<T>(etl::forward<U>(value)); 
         }
 
         /// unwrap ok value or return default value
         template <typename U>
         constexpr T unwrap_or(U&& value) const& { 
-            return variant.index() == 1 ? std::get<Ok<T>>(variant).data : static_cast<T>(etl::forward<U>(value)); 
+            return variant.index() == 1 ? variant.template get<Ok<T>>().data : static_cast<T>(etl::forward<U>(value)); 
         }
 
         /// unwrap err value
-        constexpr E& unwrap_err() & { return std::get<Err<E>>(variant).data; }
+        constexpr E& unwrap_err() & { return variant.template get<Err<E>>().data; }
 
         /// unwrap err value
-        constexpr E&& unwrap_err() && { return etl::move(std::get<Err<E>>(variant).data); }
+        constexpr E&& unwrap_err() && { return etl::move(variant.template get<Err<E>>().data); }
         
         /// unwrap err value
-        constexpr const E& unwrap_err() const& { return std::get<Err<E>>(variant).data; }
+        constexpr const E& unwrap_err() const& { return variant.template get<Err<E>>().data; }
 
         /// unwrap err value
-        constexpr const E&& unwrap_err() const&& { return etl::move(std::get<Err<E>>(variant).data); }
+        constexpr const E&& unwrap_err() const&& { return etl::move(variant.template get<Err<E>>().data); }
 
         /// unwrap err value or return default value
         template <typename U>
         constexpr E unwrap_err_or(U&& value) && { 
-            return variant.index() == 2 ? etl::move(std::get<Err<E>>(variant).data) : static_cast<E>(etl::forward<U>(value)); 
+            return variant.index() == 2 ? etl::move(variant.template get<Err<E>>().data) : static_cast<E>(etl::forward<U>(value)); 
         }
 
         /// unwrap err value or return default value
         template <typename U>
         constexpr E unwrap_err_or(U&& value) const& { 
-            return variant.index() == 2 ? std::get<Err<E>>(variant).data : static_cast<E>(etl::forward<U>(value)); 
+            return variant.index() == 2 ? variant.template get<Err<E>>().data : static_cast<E>(etl::forward<U>(value)); 
         }
 
         /// structured binding support
@@ -299,7 +299,7 @@ namespace Project::etl {
     private:
         constexpr Result() = default;
 
-        std::variant<None, Ok<T>, Err<E>> variant;
+        Variant<None, Ok<T>, Err<E>> variant;
 
         template <typename TT, typename EE>
         friend class Result;
@@ -364,22 +364,22 @@ namespace Project::etl {
 
         constexpr void unwrap() const { return; }
 
-        constexpr E& unwrap_err() & { return std::get<Err<E>>(variant).data; }
+        constexpr E& unwrap_err() & { return variant.template get<Err<E>>().data; }
 
-        constexpr E&& unwrap_err() && { return etl::move(std::get<Err<E>>(variant).data); }
+        constexpr E&& unwrap_err() && { return etl::move(variant.template get<Err<E>>().data); }
         
-        constexpr const E& unwrap_err() const& { return std::get<Err<E>>(variant).data; }
+        constexpr const E& unwrap_err() const& { return variant.template get<Err<E>>().data; }
 
-        constexpr const E&& unwrap_err() const&& { return etl::move(std::get<Err<E>>(variant).data); }
+        constexpr const E&& unwrap_err() const&& { return etl::move(variant.template get<Err<E>>().data); }
 
         template <typename U>
         constexpr E unwrap_err_or(U&& value) && { 
-            return variant.index() == 2 ? etl::move(std::get<Err<E>>(variant).data) : static_cast<E>(etl::forward<U>(value)); 
+            return variant.index() == 2 ? etl::move(variant.template get<Err<E>>().data) : static_cast<E>(etl::forward<U>(value)); 
         }
 
         template <typename U>
         constexpr E unwrap_err_or(U&& value) const& { 
-            return variant.index() == 2 ? std::get<Err<E>>(variant).data : static_cast<E>(etl::forward<U>(value)); 
+            return variant.index() == 2 ? variant.template get<Err<E>>().data : static_cast<E>(etl::forward<U>(value)); 
         }
         
         template <size_t I>
@@ -521,7 +521,7 @@ namespace Project::etl {
     private:
         constexpr Result() {}
 
-        std::variant<None, Ok<>, Err<E>> variant;
+        Variant<None, Ok<>, Err<E>> variant;
 
         template <typename TT, typename EE>
         friend class Result;
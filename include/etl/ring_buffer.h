@@ -0,0 +1,295 @@
+#ifndef ETL_RING_BUFFER_H
+#define ETL_RING_BUFFER_H
+
+#include "etl/algorithm.h"
+#include <cstring> // memcpy
+#include <new>
+
+namespace Project::etl {
+
+    /// fixed-capacity FIFO circular buffer, the items are stored in place.
+    /// @tparam N capacity, has to be a power of two so that wrapping is a bitmask
+    /// @note the read and write counters run freely and are masked on access, so all N slots are usable
+    template <typename T, size_t N>
+    class RingBuffer {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "capacity has to be a power of two");
+        static constexpr size_t mask = N - 1;
+
+        alignas(T) unsigned char storage[N * sizeof(T)];
+        size_t head = 0; ///< read counter
+        size_t tail = 0; ///< write counter
+
+    public:
+        template <typename U>
+        class Iterator;
+
+        typedef T value_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef Iterator<T> iterator;
+        typedef Iterator<const T> const_iterator;
+
+        /// empty constructor
+        constexpr RingBuffer() {}
+
+        /// construct from initializer list, excess items are discarded
+        RingBuffer(std::initializer_list<T>&& items) {
+            for (auto& it : items) if (!push(etl::move(it))) break;
+        }
+
+        /// copy constructor
+        RingBuffer(const RingBuffer& other) { *this = other; }
+
+        /// move constructor
+        RingBuffer(RingBuffer&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment
+        RingBuffer& operator=(const RingBuffer& other) {
+            if (this == &other) return *this;
+            clear();
+            for (auto& it : other) push(it);
+            return *this;
+        }
+
+        /// move assignment
+        RingBuffer& operator=(RingBuffer&& other) noexcept {
+            if (this == &other) return *this;
+            clear();
+            for (auto& it : other) push(etl::move(it));
+            other.clear();
+            return *this;
+        }
+
+        /// destructor
+        ~RingBuffer() { clear(); }
+
+        [[nodiscard]] size_t len() const { return tail - head; }         ///< returns the number of items
+        [[nodiscard]] static constexpr size_t size() { return N; }       ///< returns the capacity
+
+        /// return true if no more item can be pushed without overwriting
+        bool is_full() const { return len() == N; }
+
+        /// return true if not empty
+        explicit operator bool() const { return tail != head; }
+
+        iterator begin() { return { buf_(), head }; }
+        iterator end()   { return { buf_(), tail }; }
+
+        const_iterator begin() const { return { buf_(), head }; }
+        const_iterator end()   const { return { buf_(), tail }; }
+
+        /// get the oldest item
+        /// @warning make sure the buffer is not empty
+        reference front() { return slot_(head); }
+        const_reference front() const { return slot_(head); }
+
+        /// get the newest item
+        /// @warning make sure the buffer is not empty
+        reference back() { return slot_(tail - 1); }
+        const_reference back() const { return slot_(tail - 1); }
+
+        /// get i-th oldest item, negative index counts from the newest item
+        /// @warning it will be error null dereference if index is not valid
+        reference operator[](int i) { return is_valid_index_(i) ? slot_(head + i) : *static_cast<T*>(nullptr); }
+        const_reference operator[](int i) const { return is_valid_index_(i) ? slot_(head + i) : *static_cast<const T*>(nullptr); }
+
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// slice operator, indexes are relative to the oldest item
+        Iter<iterator> operator()(int start, int stop, int step = 1) { return Iter(begin() + clamp_(start), begin() + clamp_(stop), step); }
+        Iter<const_iterator> operator()(int start, int stop, int step = 1) const { return Iter(begin() + clamp_(start), begin() + clamp_(stop), step); }
+
+        /// push operator
+        template <typename U>
+        RingBuffer& operator<<(U&& item) { push(etl::forward<U>(item)); return *this; }
+
+        /// pop operator
+        RingBuffer& operator>>(reference item) { pop(item); return *this; }
+
+        /// construct an item in place at the back
+        /// @return 0: the buffer is full, 1: success
+        template <typename... Args>
+        int emplace(Args&&... args) {
+            if (is_full())
+                return 0;
+            new(&slot_(tail)) T(etl::forward<Args>(args)...);
+            ++tail;
+            return 1;
+        }
+
+        /// push an item at the back
+        /// @return 0: the buffer is full, 1: success
+        template <typename U>
+        int push(U&& item) { return emplace(etl::forward<U>(item)); }
+
+        /// push an item at the back, the oldest item is dropped if the buffer is full
+        /// @return 1: no item is dropped, 0: the oldest item is overwritten
+        template <typename U>
+        int push_overwrite(U&& item) {
+            int res = !is_full();
+            if (!res) pop();
+            emplace(etl::forward<U>(item));
+            return res;
+        }
+
+        /// removes the oldest item and retrieves its value
+        /// @return 0: the buffer is empty, 1: success
+        int pop(reference item) {
+            if (!*this)
+                return 0;
+            item = etl::move(front());
+            return pop();
+        }
+
+        /// removes the oldest item
+        /// @return 0: the buffer is empty, 1: success
+        int pop() {
+            if (!*this)
+                return 0;
+            front().~T();
+            ++head;
+            return 1;
+        }
+
+        /// delete all items
+        void clear() { while (pop()); }
+
+        /// copy items to the back, stops when the buffer is full
+        /// @return number of items written
+        /// @note trivially copyable items are copied with at most two memcpy
+        size_t write(const T* src, size_t n) {
+            n = etl::min(n, N - len());
+            if constexpr (etl::is_trivially_copyable_v<T>) {
+                auto [first, second] = split_(tail, n);
+                ::memcpy(&slot_(tail), src, first * sizeof(T));
+                ::memcpy(buf_(), src + first, second * sizeof(T));
+                tail += n;
+            } else {
+                for (size_t i = 0; i < n; ++i) emplace(src[i]);
+            }
+            return n;
+        }
+
+        /// copy all items of a contiguous sequence, e.g. Span, Vector, Array or StaticVector
+        template <typename Container, typename = etl::void_t<decltype(etl::declval<const Container&>().data())>>
+        size_t write(const Container& src) { return write(src.data(), etl::len(src)); }
+
+        /// move the oldest items out of the buffer
+        /// @return number of items read
+        /// @note trivially copyable items are copied with at most two memcpy
+        size_t read(T* dest, size_t n) {
+            n = etl::min(n, len());
+            if constexpr (etl::is_trivially_copyable_v<T>) {
+                auto [first, second] = split_(head, n);
+                ::memcpy(dest, &slot_(head), first * sizeof(T));
+                ::memcpy(dest + first, buf_(), second * sizeof(T));
+                head += n;
+            } else {
+                for (size_t i = 0; i < n; ++i) pop(dest[i]);
+            }
+            return n;
+        }
+
+        /// move the oldest items into the elements of a contiguous sequence, e.g. Span, Array or Vector
+        /// @return number of items read, at most the length of the sequence
+        template <typename Container, typename = etl::enable_if_t<etl::is_same_v<decltype(etl::declval<Container&>().data()), T*>>>
+        size_t read(Container&& dest) { return read(dest.data(), etl::len(dest)); }
+
+        /// contiguous views of the readable region, the second view is empty unless the items wrap around
+        /// @note the items stay in the buffer, use consume() to drop them after processing
+        Pair<Iter<T*>, Iter<T*>> peek() {
+            auto [first, second] = split_(head, len());
+            auto p = &slot_(head);
+            return { Iter(p, p + first, 1), Iter(buf_(), buf_() + second, 1) };
+        }
+
+        Pair<Iter<const T*>, Iter<const T*>> peek() const {
+            auto [first, second] = split_(head, len());
+            auto p = &slot_(head);
+            return { Iter(p, p + first, 1), Iter(buf_(), buf_() + second, 1) };
+        }
+
+        /// drop the n oldest items
+        /// @return number of dropped items
+        size_t consume(size_t n) {
+            n = etl::min(n, len());
+            for (size_t i = 0; i < n; ++i) pop();
+            return n;
+        }
+
+    private:
+        T* buf_() { return reinterpret_cast<T*>(storage); }
+        const T* buf_() const { return reinterpret_cast<const T*>(storage); }
+
+        T& slot_(size_t counter) { return buf_()[counter & mask]; }
+        const T& slot_(size_t counter) const { return buf_()[counter & mask]; }
+
+        /// split n items starting at a counter into the part before the end of the storage and the wrapped part
+        static Pair<size_t, size_t> split_(size_t counter, size_t n) {
+            size_t first = etl::min(n, N - (counter & mask));
+            return { first, n - first };
+        }
+
+        int clamp_(int i) const {
+            if (i < 0) i += int(len()); // allowing negative index
+            return etl::clamp(i, 0, int(len()));
+        }
+
+        bool is_valid_index_(int& index) const {
+            if (index < 0) index = int(len()) + index; // allowing negative index
+            return index >= 0 && size_t(index) < len();
+        }
+    };
+
+    template <typename T, size_t N>
+    template <typename U>
+    class RingBuffer<T, N>::Iterator {
+        friend class RingBuffer<T, N>;
+        U* buf;
+        size_t counter;
+
+        Iterator(U* buf, size_t counter) : buf(buf), counter(counter) {}
+
+    public:
+        /// empty constructor
+        Iterator() : buf(nullptr), counter(0) {}
+
+        U& operator*() const { return buf[counter & mask]; }
+        U* operator->() const { return &buf[counter & mask]; }
+        U& operator[](int i) const { return buf[(counter + i) & mask]; }
+
+        bool operator==(const Iterator& other) const { return counter == other.counter; }
+        bool operator!=(const Iterator& other) const { return counter != other.counter; }
+
+        Iterator& operator++() { ++counter; return *this; }
+        Iterator& operator--() { --counter; return *this; }
+        Iterator operator++(int) { return { buf, counter++ }; } // NOLINT
+        Iterator operator--(int) { return { buf, counter-- }; } // NOLINT
+
+        Iterator operator+(int pos) const { return { buf, counter + pos }; }
+        Iterator operator-(int pos) const { return { buf, counter - pos }; }
+        Iterator& operator+=(int pos) { counter += pos; return *this; }
+        Iterator& operator-=(int pos) { counter -= pos; return *this; }
+
+        size_t operator-(const Iterator& other) const { return counter - other.counter; }
+    };
+
+    /// type traits
+    template <typename T> struct is_ring_buffer : false_type {};
+    template <typename T, size_t N> struct is_ring_buffer<RingBuffer<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_ring_buffer<const RingBuffer<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_ring_buffer<volatile RingBuffer<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_ring_buffer<const volatile RingBuffer<T, N>> : true_type {};
+    template <typename T> inline constexpr bool is_ring_buffer_v = is_ring_buffer<T>::value;
+
+    template <typename T, size_t N> struct remove_extent<RingBuffer<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const RingBuffer<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<volatile RingBuffer<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const volatile RingBuffer<T, N>> { typedef T type; };
+}
+
+#endif //ETL_RING_BUFFER_H
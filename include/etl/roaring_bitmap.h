@@ -0,0 +1,759 @@
+#ifndef ETL_ROARING_BITMAP_H
+#define ETL_ROARING_BITMAP_H
+
+#include "etl/vector.h"
+#include "etl/bit.h"
+#include <cstring> // memset
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Project::etl::detail {
+
+#if defined(__SSE2__)
+    /// rotate the 16-bit lanes of a vector by K lanes
+    template <int K> inline __m128i roaring_rotate(__m128i v) {
+        return _mm_or_si128(_mm_srli_si128(v, 2 * K), _mm_slli_si128(v, 16 - 2 * K));
+    }
+#endif
+
+    /// intersection of two sorted arrays of unique 16-bit values
+    /// @return number of values written to out, which must have room for the smaller array
+    inline size_t roaring_intersect(const uint16_t* a, size_t na, const uint16_t* b, size_t nb, uint16_t* out) {
+        if (na > nb) {
+            etl::swap(a, b);
+            etl::swap(na, nb);
+        }
+
+        size_t i = 0, j = 0, n = 0;
+        if (na * 64 < nb) {
+            // the values of the small array are searched in the big one with exponential steps
+            for (; i < na && j < nb; ++i) {
+                size_t step = 1;
+                while (j + step < nb && b[j + step] < a[i]) step *= 2;
+                j = etl::lower_bound(b + j, b + etl::min(j + step + 1, nb), a[i]) - b;
+                if (j < nb && b[j] == a[i]) out[n++] = a[i];
+            }
+            return n;
+        }
+
+#if defined(__SSE2__)
+        // compare every value of a block of 8 with every value of the other block of 8,
+        // then drop the block with the smaller maximum, or both if the maximums are equal
+        const size_t na8 = na & ~size_t(7), nb8 = nb & ~size_t(7);
+        while (i < na8 && j < nb8) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+            __m128i eq = _mm_cmpeq_epi16(va, vb);
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<1>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<2>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<3>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<4>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<5>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<6>(vb)));
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi16(va, roaring_rotate<7>(vb)));
+
+            // one bit per 16-bit lane
+            uint32_t mask = uint32_t(_mm_movemask_epi8(eq)) & 0x5555u;
+            for (; mask != 0; mask &= mask - 1) out[n++] = a[i + etl::count_trailing_zeros(mask) / 2];
+
+            const uint16_t aMax = a[i + 7], bMax = b[j + 7];
+            if (aMax <= bMax) i += 8;
+            if (bMax <= aMax) j += 8;
+        }
+#endif
+
+        while (i < na && j < nb) {
+            if (a[i] < b[j]) ++i;
+            else if (b[j] < a[i]) ++j;
+            else {
+                out[n++] = a[i];
+                ++i;
+                ++j;
+            }
+        }
+        return n;
+    }
+
+    /// the low 16 bits of the values of a roaring bitmap that share the same high 16 bits.
+    /// an array container keeps the sorted values, a bitmap container keeps 65536 bits,
+    /// and a run container keeps the start and the length - 1 of every run of consecutive values
+    /// @note an array container has at most 4096 values, a bitmap container has more
+    template <typename A>
+    struct RoaringContainer {
+        enum Type : uint8_t { ARRAY, BITMAP, RUN };
+
+        static constexpr uint32_t array_max = 4096;
+        static constexpr size_t bitmap_words = 1024;
+
+        Vector<uint16_t, etl::allocator_rebind_t<A, uint16_t>> values;
+        Vector<uint64_t, etl::allocator_rebind_t<A, uint64_t>> words;
+        uint32_t cardinality = 0;
+        uint16_t key = 0;
+        Type type = ARRAY;
+
+        RoaringContainer() = default;
+        explicit RoaringContainer(uint16_t key) : key(key) {}
+
+        size_t runs() const { return values.len() / 2; }
+        uint16_t run_start(size_t r) const { return values.begin()[2 * r]; }
+        uint32_t run_last(size_t r) const { return uint32_t(values.begin()[2 * r]) + values.begin()[2 * r + 1]; }
+
+        bool contains(uint16_t x) const {
+            if (type == BITMAP) return words.begin()[x / 64] >> (x % 64) & 1u;
+            if (type == ARRAY) {
+                auto it = etl::lower_bound(values.begin(), values.end(), x);
+                return it != values.end() && *it == x;
+            }
+
+            // number of runs that start at or before x
+            size_t lo = 0, hi = runs();
+            while (lo < hi) {
+                const size_t mid = (lo + hi) / 2;
+                if (run_start(mid) <= x) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo > 0 && x <= run_last(lo - 1);
+        }
+
+        /// @return false if x is already in the container or allocation fails
+        bool add(uint16_t x) {
+            if (type == RUN && (contains(x) || !to_plain())) return false;
+            if (type == ARRAY) {
+                auto it = etl::lower_bound(values.begin(), values.end(), x);
+                if (it != values.end() && *it == x) return false;
+                if (cardinality < array_max) {
+                    values.insert(int(it - values.begin()), x);
+                    if (values.len() == cardinality) return false;
+                    ++cardinality;
+                    return true;
+                }
+                if (!to_bitmap()) return false;
+            }
+
+            uint64_t& word = words.begin()[x / 64];
+            const uint64_t mask = uint64_t(1) << (x % 64);
+            if (word & mask) return false;
+            word |= mask;
+            ++cardinality;
+            return true;
+        }
+
+        /// @return false if x is not in the container or allocation fails
+        bool remove(uint16_t x) {
+            if (!contains(x) || !to_plain()) return false;
+            --cardinality;
+            if (type == ARRAY) {
+                values.remove_at(int(etl::lower_bound(values.begin(), values.end(), x) - values.begin()));
+                return true;
+            }
+            words.begin()[x / 64] &= ~(uint64_t(1) << (x % 64));
+            if (cardinality <= array_max && !to_array()) {
+                // put x back, a bitmap must hold more than array_max values
+                words.begin()[x / 64] |= uint64_t(1) << (x % 64);
+                ++cardinality;
+                return false;
+            }
+            return true;
+        }
+
+        /// call a function for every value in increasing order
+        template <typename F>
+        void foreach(F&& fn) const {
+            if (type == ARRAY) {
+                for (auto x : values) fn(x);
+            } else if (type == BITMAP) {
+                for (size_t i = 0; i < bitmap_words; ++i) {
+                    for (uint64_t word = words.begin()[i]; word != 0; word &= word - 1)
+                        fn(uint16_t(i * 64 + etl::count_trailing_zeros(word)));
+                }
+            } else {
+                for (size_t r = 0; r < runs(); ++r) {
+                    for (uint32_t x = run_start(r); x <= run_last(r); ++x) fn(uint16_t(x));
+                }
+            }
+        }
+
+        /// number of runs of consecutive values
+        size_t count_runs() const {
+            size_t res = 0;
+            if (type == ARRAY) {
+                for (size_t i = 0; i < values.len(); ++i)
+                    res += i == 0 || values.begin()[i] != values.begin()[i - 1] + 1;
+            } else if (type == BITMAP) {
+                uint64_t carry = 0;
+                for (auto word : words) {
+                    res += etl::count_bits(word & ~((word << 1) | carry));
+                    carry = word >> 63;
+                }
+            } else {
+                res = runs();
+            }
+            return res;
+        }
+
+        bool to_bitmap() {
+            if (type == BITMAP) return true;
+
+            decltype(words) bits(bitmap_words, true);
+            if (!bits) return false;
+
+            uint64_t* w = bits.data();
+            ::memset(w, 0, bitmap_words * sizeof(uint64_t));
+            if (type == ARRAY) {
+                for (auto x : values) w[x / 64] |= uint64_t(1) << (x % 64);
+            } else for (size_t r = 0; r < runs(); ++r) {
+                const uint32_t first = run_start(r), last = run_last(r);
+                const uint32_t a = first / 64, b = last / 64;
+                const uint64_t lowMask = ~uint64_t(0) << (first % 64);
+                const uint64_t highMask = ~uint64_t(0) >> (63 - last % 64);
+                if (a == b) {
+                    w[a] |= lowMask & highMask;
+                    continue;
+                }
+                w[a] |= lowMask;
+                for (uint32_t i = a + 1; i < b; ++i) w[i] = ~uint64_t(0);
+                w[b] |= highMask;
+            }
+
+            words = etl::move(bits);
+            values = {};
+            type = BITMAP;
+            return true;
+        }
+
+        bool to_array() {
+            if (type == ARRAY) return true;
+
+            decltype(values) vals(cardinality, true);
+            if (cardinality > 0 && !vals) return false;
+
+            uint16_t* out = vals.data();
+            foreach([&out](uint16_t x) { *out++ = x; });
+
+            values = etl::move(vals);
+            words = {};
+            type = ARRAY;
+            return true;
+        }
+
+        bool to_run() {
+            if (type == RUN) return true;
+
+            decltype(values) vals(2 * count_runs(), true);
+            if (cardinality > 0 && !vals) return false;
+
+            uint16_t* out = vals.data();
+            uint32_t start = 0, last = 0;
+            bool first = true;
+            foreach([&](uint16_t x) {
+                if (first || x != last + 1) {
+                    if (!first) { *out++ = uint16_t(start); *out++ = uint16_t(last - start); }
+                    start = x;
+                    first = false;
+                }
+                last = x;
+            });
+            if (!first) { *out++ = uint16_t(start); *out++ = uint16_t(last - start); }
+
+            values = etl::move(vals);
+            words = {};
+            type = RUN;
+            return true;
+        }
+
+        /// convert a run container to an array or a bitmap container depending on its cardinality
+        bool to_plain() { return type != RUN || (cardinality <= array_max ? to_array() : to_bitmap()); }
+
+        /// convert to the representation that takes the least memory
+        bool optimize() {
+            const size_t runBytes = 4 * count_runs();
+            const size_t plainBytes = cardinality <= array_max ? 2 * cardinality : bitmap_words * sizeof(uint64_t);
+            return runBytes < plainBytes ? to_run() : to_plain();
+        }
+
+        /// copy of a container without runs, the container itself if it has no runs
+        static const RoaringContainer& plain(const RoaringContainer& c, RoaringContainer& temp) {
+            if (c.type != RUN) return c;
+            temp = c;
+            temp.to_plain();
+            return temp;
+        }
+
+        static RoaringContainer union_of(const RoaringContainer& x, const RoaringContainer& y) {
+            RoaringContainer ta, tb, res(x.key);
+            const RoaringContainer& a = plain(x, ta);
+            const RoaringContainer& b = plain(y, tb);
+
+            if (a.type == ARRAY && b.type == ARRAY) {
+                decltype(values) vals(a.cardinality + b.cardinality, true);
+                if (!vals) return res;
+
+                const uint16_t* p = a.values.begin(), *pEnd = a.values.end();
+                const uint16_t* q = b.values.begin(), *qEnd = b.values.end();
+                uint16_t* out = vals.data();
+                while (p != pEnd && q != qEnd) {
+                    if (*p < *q) *out++ = *p++;
+                    else if (*q < *p) *out++ = *q++;
+                    else { *out++ = *p++; ++q; }
+                }
+                while (p != pEnd) *out++ = *p++;
+                while (q != qEnd) *out++ = *q++;
+
+                res.cardinality = uint32_t(out - vals.data());
+                vals.resize(res.cardinality);
+                res.values = etl::move(vals);
+                if (res.cardinality > array_max) res.to_bitmap();
+                return res;
+            }
+
+            const RoaringContainer& bm = a.type == BITMAP ? a : b;
+            const RoaringContainer& other = a.type == BITMAP ? b : a;
+            res.words = bm.words;
+            res.type = BITMAP;
+            uint64_t* w = res.words.data();
+            if (other.type == BITMAP) {
+                for (size_t i = 0; i < bitmap_words; ++i) w[i] |= other.words.begin()[i];
+            } else {
+                for (auto x : other.values) w[x / 64] |= uint64_t(1) << (x % 64);
+            }
+            for (size_t i = 0; i < bitmap_words; ++i) res.cardinality += etl::count_bits(w[i]);
+            return res;
+        }
+
+        static RoaringContainer intersection_of(const RoaringContainer& x, const RoaringContainer& y) {
+            RoaringContainer ta, tb, res(x.key);
+            const RoaringContainer& a = plain(x, ta);
+            const RoaringContainer& b = plain(y, tb);
+
+            if (a.type == BITMAP && b.type == BITMAP) {
+                res.words = a.words;
+                res.type = BITMAP;
+                uint64_t* w = res.words.data();
+                for (size_t i = 0; i < bitmap_words; ++i) {
+                    w[i] &= b.words.begin()[i];
+                    res.cardinality += etl::count_bits(w[i]);
+                }
+                if (res.cardinality <= array_max) res.to_array();
+                return res;
+            }
+
+            decltype(values) vals(etl::min(a.cardinality, b.cardinality), true);
+            if (!vals) return res;
+
+            if (a.type == ARRAY && b.type == ARRAY) {
+                res.cardinality = uint32_t(roaring_intersect(
+                    a.values.begin(), a.values.len(), b.values.begin(), b.values.len(), vals.data()));
+            } else {
+                const RoaringContainer& arr = a.type == ARRAY ? a : b;
+                const RoaringContainer& bm = a.type == ARRAY ? b : a;
+                for (auto v : arr.values) if (bm.contains(v)) vals.begin()[res.cardinality++] = v;
+            }
+            vals.resize(res.cardinality);
+            res.values = etl::move(vals);
+            return res;
+        }
+
+        static RoaringContainer difference_of(const RoaringContainer& x, const RoaringContainer& y) {
+            RoaringContainer ta, tb, res(x.key);
+            const RoaringContainer& a = plain(x, ta);
+            const RoaringContainer& b = plain(y, tb);
+
+            if (a.type == BITMAP) {
+                res.words = a.words;
+                res.type = BITMAP;
+                uint64_t* w = res.words.data();
+                if (b.type == BITMAP) {
+                    for (size_t i = 0; i < bitmap_words; ++i) w[i] &= ~b.words.begin()[i];
+                } else {
+                    for (auto v : b.values) w[v / 64] &= ~(uint64_t(1) << (v % 64));
+                }
+                for (size_t i = 0; i < bitmap_words; ++i) res.cardinality += etl::count_bits(w[i]);
+                if (res.cardinality <= array_max) res.to_array();
+                return res;
+            }
+
+            decltype(values) vals(a.cardinality, true);
+            if (!vals) return res;
+
+            uint16_t* out = vals.data();
+            if (b.type == ARRAY) {
+                const uint16_t* q = b.values.begin(), *qEnd = b.values.end();
+                for (auto v : a.values) {
+                    while (q != qEnd && *q < v) ++q;
+                    if (q == qEnd || *q != v) *out++ = v;
+                }
+            } else {
+                for (auto v : a.values) if (!b.contains(v)) *out++ = v;
+            }
+            res.cardinality = uint32_t(out - vals.data());
+            vals.resize(res.cardinality);
+            res.values = etl::move(vals);
+            return res;
+        }
+    };
+}
+
+namespace Project::etl {
+
+    /// compressed set of 32-bit unsigned integers.
+    /// the values are grouped by their high 16 bits into containers sorted by key,
+    /// each container picks the array, bitmap or run representation of the low 16 bits.
+    /// sparse chunks cost 2 bytes per value, dense chunks cost 8 kB, and long runs cost 4 bytes per run
+    /// @note add and remove never create run containers, call optimize to compress the runs
+    template <typename A = etl::Allocator<uint32_t>>
+    class RoaringBitmap {
+        typedef detail::RoaringContainer<A> Container;
+
+        Vector<Container, etl::allocator_rebind_t<A, Container>> containers;
+        size_t nItems = 0;
+
+    public:
+        typedef uint32_t value_type;
+        typedef A Alloc;
+
+        /// iterator over the values in increasing order
+        class iterator {
+            const Container* c;
+            const Container* last;
+            uint32_t i = 0;     ///< position in an array container, or run index of a run container
+            uint32_t low = 0;   ///< low 16 bits of the current value
+            size_t n;           ///< number of values before the current value
+
+        public:
+            iterator(const Container* c, const Container* last, size_t n) : c(c), last(last), n(n) {
+                if (c != last) first_();
+            }
+
+            uint32_t operator*() const { return uint32_t(c->key) << 16 | low; }
+
+            iterator& operator++() {
+                ++n;
+                if (c->type == Container::ARRAY) {
+                    if (++i < c->cardinality) {
+                        low = c->values.begin()[i];
+                        return *this;
+                    }
+                } else if (c->type == Container::BITMAP) {
+                    const uint32_t next = low + 1;
+                    if (next < 65536) {
+                        size_t w = next / 64;
+                        uint64_t word = c->words.begin()[w] & (~uint64_t(0) << (next % 64));
+                        while (word == 0 && ++w < Container::bitmap_words) word = c->words.begin()[w];
+                        if (word != 0) {
+                            low = uint32_t(w * 64 + etl::count_trailing_zeros(word));
+                            return *this;
+                        }
+                    }
+                } else {
+                    if (low < c->run_last(i)) {
+                        ++low;
+                        return *this;
+                    }
+                    if (++i < c->runs()) {
+                        low = c->run_start(i);
+                        return *this;
+                    }
+                }
+
+                low = 0;
+                if (++c != last) first_();
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const { return c == other.c && low == other.low; }
+            bool operator!=(const iterator& other) const { return !operator==(other); }
+
+            /// number of values between two iterators
+            size_t operator-(const iterator& other) const { return n - other.n; }
+
+        private:
+            void first_() {
+                i = 0;
+                if (c->type == Container::BITMAP) {
+                    size_t w = 0;
+                    while (c->words.begin()[w] == 0) ++w;
+                    low = uint32_t(w * 64 + etl::count_trailing_zeros(c->words.begin()[w]));
+                } else {
+                    low = c->values.begin()[0];
+                }
+            }
+        };
+
+        typedef iterator const_iterator;
+
+        /// empty constructor
+        constexpr RoaringBitmap() {}
+
+        [[nodiscard]] size_t len() const { return nItems; } ///< returns the number of values
+
+        /// number of containers, one per distinct high 16 bits
+        [[nodiscard]] size_t container_len() const { return containers.len(); }
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        iterator begin() const { return { containers.begin(), containers.end(), 0 }; }
+        iterator end()   const { return { containers.end(), containers.end(), nItems }; }
+
+        Iter<iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// check if a value is in this bitmap
+        bool contains(uint32_t x) const {
+            const Container* c = find_(uint16_t(x >> 16));
+            return c != containers.end() && c->key == uint16_t(x >> 16) && c->contains(uint16_t(x));
+        }
+
+        /// add a value
+        /// @return false if the value already exists or allocation fails
+        bool add(uint32_t x) {
+            const uint16_t key = uint16_t(x >> 16);
+            Container* c = find_(key);
+            if (c == containers.end() || c->key != key) {
+                const int index = int(c - containers.begin());
+                const size_t n = containers.len();
+                containers.insert(index, Container(key));
+                if (containers.len() == n) return false;
+                c = containers.begin() + index;
+            }
+
+            if (!c->add(uint16_t(x))) {
+                if (c->cardinality == 0) containers.remove_at(int(c - containers.begin()));
+                return false;
+            }
+            ++nItems;
+            return true;
+        }
+
+        /// add operator
+        RoaringBitmap& operator<<(uint32_t x) { add(x); return *this; }
+
+        /// remove a value
+        /// @return false if the value doesn't exist or allocation fails
+        bool remove(uint32_t x) {
+            Container* c = find_(uint16_t(x >> 16));
+            if (c == containers.end() || c->key != uint16_t(x >> 16) || !c->remove(uint16_t(x))) return false;
+            if (c->cardinality == 0) containers.remove_at(int(c - containers.begin()));
+            --nItems;
+            return true;
+        }
+
+        /// remove all values
+        void clear() {
+            containers.clear();
+            nItems = 0;
+        }
+
+        /// convert every container to the representation that takes the least memory
+        /// @return false if allocation fails, the bitmap keeps its values anyway
+        bool optimize() {
+            bool res = true;
+            for (auto& c : containers) res &= c.optimize();
+            return res;
+        }
+
+        RoaringBitmap& operator|=(const RoaringBitmap& other) { return *this = *this | other; }
+        RoaringBitmap& operator&=(const RoaringBitmap& other) { return *this = *this & other; }
+        RoaringBitmap& operator-=(const RoaringBitmap& other) { return *this = *this - other; }
+
+        /// values that are in either bitmap
+        RoaringBitmap operator|(const RoaringBitmap& other) const {
+            RoaringBitmap res;
+            res.containers.reserve(containers.len() + other.containers.len());
+
+            const Container* p = containers.begin(), *pEnd = containers.end();
+            const Container* q = other.containers.begin(), *qEnd = other.containers.end();
+            while (p != pEnd || q != qEnd) {
+                if (q == qEnd || (p != pEnd && p->key < q->key)) res.push_(Container(*p++));
+                else if (p == pEnd || q->key < p->key) res.push_(Container(*q++));
+                else res.push_(Container::union_of(*p++, *q++));
+            }
+            return res;
+        }
+
+        /// values that are in both bitmaps
+        RoaringBitmap operator&(const RoaringBitmap& other) const {
+            RoaringBitmap res;
+            const Container* p = containers.begin(), *pEnd = containers.end();
+            const Container* q = other.containers.begin(), *qEnd = other.containers.end();
+            while (p != pEnd && q != qEnd) {
+                if (p->key < q->key) ++p;
+                else if (q->key < p->key) ++q;
+                else res.push_(Container::intersection_of(*p++, *q++));
+            }
+            return res;
+        }
+
+        /// values that are in this bitmap but not in the other
+        RoaringBitmap operator-(const RoaringBitmap& other) const {
+            RoaringBitmap res;
+            res.containers.reserve(containers.len());
+
+            const Container* q = other.containers.begin(), *qEnd = other.containers.end();
+            for (const auto& c : containers) {
+                while (q != qEnd && q->key < c.key) ++q;
+                if (q == qEnd || q->key != c.key) res.push_(Container(c));
+                else res.push_(Container::difference_of(c, *q));
+            }
+            return res;
+        }
+
+        bool operator==(const RoaringBitmap& other) const {
+            if (nItems != other.nItems) return false;
+            for (auto p = begin(), q = other.begin(); p != end(); ++p, ++q) if (*p != *q) return false;
+            return true;
+        }
+
+        bool operator!=(const RoaringBitmap& other) const { return !operator==(other); }
+
+        /// number of bytes written by serialize
+        size_t serialized_len() const {
+            size_t res = 4;
+            for (const auto& c : containers) {
+                res += 5;
+                res += c.type == Container::BITMAP ? Container::bitmap_words * 8 : c.values.len() * 2;
+            }
+            return res;
+        }
+
+        /// write this bitmap in a compact little-endian form:
+        /// the number of containers as 4 bytes, then for every container its key as 2 bytes, its type as 1 byte,
+        /// its number of values (or runs) - 1 as 2 bytes, then its values as 2 bytes each, its words as 8 bytes each,
+        /// or its runs as 2 bytes start and 2 bytes length - 1 each
+        /// @return number of bytes written, 0 if the buffer is too small
+        size_t serialize(uint8_t* buf, size_t size) const {
+            const size_t res = serialized_len();
+            if (size < res) return 0;
+
+            auto put = [&buf](uint64_t value, size_t n) {
+                for (size_t i = 0; i < n; ++i) *buf++ = uint8_t(value >> (8 * i));
+            };
+
+            put(containers.len(), 4);
+            for (const auto& c : containers) {
+                put(c.key, 2);
+                put(c.type, 1);
+                put((c.type == Container::RUN ? c.runs() : c.cardinality) - 1, 2);
+                if (c.type == Container::BITMAP) for (auto w : c.words) put(w, 8);
+                else for (auto v : c.values) put(v, 2);
+            }
+            return res;
+        }
+
+        /// read a bitmap written by serialize, replacing the values of this bitmap
+        /// @return false if the data is malformed or allocation fails, this bitmap is empty afterwards
+        bool deserialize(const uint8_t* buf, size_t size) {
+            clear();
+            const uint8_t* bufEnd = buf + size;
+            auto get = [&buf](size_t n) {
+                uint64_t value = 0;
+                for (size_t i = 0; i < n; ++i) value |= uint64_t(*buf++) << (8 * i);
+                return value;
+            };
+            auto fail = [this] { clear(); return false; };
+
+            if (bufEnd - buf < 4) return fail();
+            const size_t n = get(4);
+            // at most one container per 16-bit key, each takes at least 5 bytes
+            if (n > 65536 || n > size_t(bufEnd - buf) / 5) return fail();
+            if (!containers.reserve(n)) return fail();
+
+            for (size_t k = 0; k < n; ++k) {
+                if (bufEnd - buf < 5) return fail();
+                Container c(uint16_t(get(2)));
+                const uint64_t type = get(1);
+                const uint32_t count = uint32_t(get(2)) + 1;
+                if (k > 0 && containers.back().key >= c.key) return fail();
+
+                if (type == Container::ARRAY) {
+                    if (count > Container::array_max || size_t(bufEnd - buf) < count * 2u) return fail();
+                    c.values = decltype(c.values)(count, true);
+                    if (!c.values) return fail();
+                    for (uint32_t i = 0; i < count; ++i) {
+                        c.values.begin()[i] = uint16_t(get(2));
+                        if (i > 0 && c.values.begin()[i - 1] >= c.values.begin()[i]) return fail();
+                    }
+                    c.cardinality = count;
+                } else if (type == Container::BITMAP) {
+                    if (count <= Container::array_max || size_t(bufEnd - buf) < Container::bitmap_words * 8) return fail();
+                    c.words = decltype(c.words)(Container::bitmap_words, true);
+                    if (!c.words) return fail();
+                    for (auto& w : c.words) {
+                        w = get(8);
+                        c.cardinality += etl::count_bits(w);
+                    }
+                    if (c.cardinality != count) return fail();
+                    c.type = Container::BITMAP;
+                } else if (type == Container::RUN) {
+                    if (size_t(bufEnd - buf) < count * 4u) return fail();
+                    c.values = decltype(c.values)(count * 2, true);
+                    if (!c.values) return fail();
+                    for (uint32_t r = 0; r < count; ++r) {
+                        c.values.begin()[2 * r] = uint16_t(get(2));
+                        c.values.begin()[2 * r + 1] = uint16_t(get(2));
+                        if (c.run_last(r) > 0xFFFF || (r > 0 && c.run_start(r) <= c.run_last(r - 1) + 1)) return fail();
+                        c.cardinality += c.values.begin()[2 * r + 1] + 1u;
+                    }
+                    c.type = Container::RUN;
+                } else {
+                    return fail();
+                }
+
+                nItems += c.cardinality;
+                if (!containers.emplace_back(etl::move(c))) return fail();
+            }
+            return buf == bufEnd || fail();
+        }
+
+        /// write this bitmap to a new byte vector
+        template <typename B = etl::allocator_rebind_t<A, uint8_t>>
+        Vector<uint8_t, B> serialize() const {
+            Vector<uint8_t, B> res(serialized_len(), true);
+            if (res) serialize(res.data(), res.len());
+            return res;
+        }
+
+    private:
+        /// first container whose key is not less than the given key
+        Container* find_(uint16_t key) {
+            return etl::lower_bound(containers.begin(), containers.end(), key,
+                [](const Container& c, uint16_t k) { return c.key < k; });
+        }
+
+        const Container* find_(uint16_t key) const { return const_cast<RoaringBitmap*>(this)->find_(key); }
+
+        /// append a container that is sorted after the existing ones, unless it is empty
+        void push_(Container&& c) {
+            if (c.cardinality == 0) return;
+            nItems += c.cardinality;
+            if (!containers.emplace_back(etl::move(c))) nItems -= c.cardinality;
+        }
+    };
+
+    /// create roaring bitmap from values
+    template <typename A = etl::Allocator<uint32_t>, typename... Ts> auto
+    roaring_bitmap(Ts... values) {
+        RoaringBitmap<A> res;
+        (res.add(uint32_t(values)), ...);
+        return res;
+    }
+
+    /// type traits
+    template <typename T> struct is_roaring_bitmap : false_type {};
+    template <typename A> struct is_roaring_bitmap<RoaringBitmap<A>> : true_type {};
+    template <typename A> struct is_roaring_bitmap<const RoaringBitmap<A>> : true_type {};
+    template <typename A> struct is_roaring_bitmap<volatile RoaringBitmap<A>> : true_type {};
+    template <typename A> struct is_roaring_bitmap<const volatile RoaringBitmap<A>> : true_type {};
+    template <typename T> inline constexpr bool is_roaring_bitmap_v = is_roaring_bitmap<T>::value;
+
+    template <typename A> struct is_trivially_relocatable<detail::RoaringContainer<A>> : true_type {};
+    template <typename A> struct is_trivially_relocatable<RoaringBitmap<A>> : true_type {};
+
+    template <typename A> struct remove_extent<RoaringBitmap<A>> { typedef uint32_t type; };
+    template <typename A> struct remove_extent<const RoaringBitmap<A>> { typedef uint32_t type; };
+    template <typename A> struct remove_extent<volatile RoaringBitmap<A>> { typedef uint32_t type; };
+    template <typename A> struct remove_extent<const volatile RoaringBitmap<A>> { typedef uint32_t type; };
+}
+
+#endif //ETL_ROARING_BITMAP_H
@@ -0,0 +1,214 @@
+#ifndef ETL_SLOT_MAP_H
+#define ETL_SLOT_MAP_H
+
+#include "etl/vector.h"
+
+namespace Project::etl {
+
+    /// generational handle to an item of a slot map, the raw value is either 32 or 64 bits wide.
+    /// the low bits are the slot index and the high bits are the generation of the slot when the item was inserted
+    /// @note a default constructed handle is null, it never refers to an item
+    template <typename U = uint64_t>
+    struct SlotHandle {
+        static_assert(etl::is_same_v<U, uint32_t> || etl::is_same_v<U, uint64_t>, "Slot handle must be 32 or 64 bits");
+
+        static constexpr unsigned index_bits = sizeof(U) == 8 ? 32 : 20;
+        static constexpr unsigned generation_bits = sizeof(U) * 8 - index_bits;
+        static constexpr U index_mask = (U(1) << index_bits) - 1;
+        static constexpr U generation_mask = (U(1) << generation_bits) - 1;
+
+        U value = 0;
+
+        constexpr SlotHandle() = default;
+        constexpr explicit SlotHandle(U value) : value(value) {}
+        constexpr SlotHandle(U index, U generation) : value((generation << index_bits) | index) {}
+
+        constexpr U index() const { return value & index_mask; }
+        constexpr U generation() const { return value >> index_bits; }
+
+        constexpr explicit operator bool() const { return value != 0; }
+        constexpr bool operator==(const SlotHandle& other) const { return value == other.value; }
+        constexpr bool operator!=(const SlotHandle& other) const { return value != other.value; }
+    };
+
+    /// unordered collection of items addressed by generational handles.
+    /// the items are stored densely in a vector so that iterating them is iterating a vector,
+    /// a table of slots maps every handle to the position of its item and the generation of the slot.
+    /// removing an item moves the last item into its place, then bumps the generation of the slot,
+    /// so every handle to the removed item is detected as stale afterwards
+    /// @note insert and remove are O(1), items move when other items are removed, handles stay valid
+    /// @note a slot whose generation would wrap around is retired instead of reused
+    template <typename T, typename A = etl::Allocator<T>, typename U = uint64_t>
+    class SlotMap {
+        struct Slot {
+            U position;     ///< position of the item in the dense storage, or the next free slot
+            U generation;   ///< current generation, even if the slot is free and odd if it is used
+        };
+
+        static constexpr U npos = SlotHandle<U>::index_mask;
+
+        Vector<T, A> items;
+        Vector<U, etl::allocator_rebind_t<A, U>> owners;    ///< slot index of each item
+        Vector<Slot, etl::allocator_rebind_t<A, Slot>> slots;
+        U freeHead = npos;
+
+    public:
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef SlotHandle<U> Handle;
+        typedef A Alloc;
+
+        /// empty constructor
+        constexpr SlotMap() {}
+
+        [[nodiscard]] size_t len() const { return items.len(); } ///< returns the number of items
+
+        /// return true if not empty
+        explicit operator bool() const { return items.len() > 0; }
+
+        iterator data()  { return items.data(); }
+        iterator begin() { return items.begin(); }
+        iterator end()   { return items.end(); }
+
+        const_iterator data()  const { return items.data(); }
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end()   const { return items.end(); }
+
+        Iter<iterator> iter() { return items.iter(); }
+        Iter<const_iterator> iter() const { return items.iter(); }
+
+        /// handle of the item at a position of the dense storage, null if the position is not valid
+        Handle handle_at(size_t position) const {
+            if (position >= items.len()) return {};
+            const U index = owners.begin()[position];
+            return { index, slots.begin()[index].generation };
+        }
+
+        /// reserve the storage of the items and the slots
+        bool reserve(size_t capacity) {
+            return items.reserve(capacity) && owners.reserve(capacity) && slots.reserve(capacity);
+        }
+
+        /// construct an item in place
+        /// @return handle to the new item, null if allocation fails or all handles are used
+        template <typename... Args>
+        Handle emplace(Args&&... args) {
+            if (freeHead == npos) {
+                const U index = U(slots.len());
+                if (index == npos || !slots.emplace_back(Slot{npos, 0})) return {};
+                freeHead = index;
+            }
+
+            if (!owners.emplace_back(freeHead)) return {};
+            if (!items.emplace_back(etl::forward<Args>(args)...)) {
+                owners.resize(owners.len() - 1);
+                return {};
+            }
+
+            const U index = freeHead;
+            Slot& slot = slots.begin()[index];
+            freeHead = slot.position;
+            slot.position = U(items.len() - 1);
+            slot.generation = (slot.generation + 1) & SlotHandle<U>::generation_mask;
+            return { index, slot.generation };
+        }
+
+        /// insert an item
+        /// @return handle to the new item, null if allocation fails or all handles are used
+        template <typename V>
+        Handle insert(V&& item) { return emplace(etl::forward<V>(item)); }
+
+        /// insert operator
+        template <typename V>
+        SlotMap& operator<<(V&& item) { insert(etl::forward<V>(item)); return *this; }
+
+        /// check if a handle refers to a live item
+        bool contains(Handle handle) const { return find(handle) != nullptr; }
+
+        /// pointer to the item of a handle, null if the handle is stale
+        T* find(Handle handle) {
+            const U index = handle.index();
+            if (index >= slots.len()) return nullptr;
+            const Slot& slot = slots.begin()[index];
+            return slot.generation == handle.generation() && (slot.generation & 1) ? items.begin() + slot.position : nullptr;
+        }
+
+        const T* find(Handle handle) const { return const_cast<SlotMap*>(this)->find(handle); }
+
+        /// get the item of a handle
+        /// @warning it will throw error null dereference if the handle is stale
+        T& get(Handle handle) { return *find(handle); }
+        const T& get(Handle handle) const { return *find(handle); }
+
+        /// get the item of a handle
+        /// @warning it will throw error null dereference if the handle is stale
+        T& operator[](Handle handle) { return *find(handle); }
+        const T& operator[](Handle handle) const { return *find(handle); }
+
+        /// remove the item of a handle, the last item is moved into its place
+        /// @return false if the handle is stale
+        bool remove(Handle handle) {
+            T* item = find(handle);
+            if (item == nullptr) return false;
+
+            const U index = handle.index();
+            const size_t position = item - items.begin();
+            const size_t lastPosition = items.len() - 1;
+            if (position != lastPosition) {
+                *item = etl::move(items.back());
+                const U moved = owners.back();
+                owners.begin()[position] = moved;
+                slots.begin()[moved].position = U(position);
+            }
+            items.resize(lastPosition);
+            owners.resize(lastPosition);
+            release_(index);
+            return true;
+        }
+
+        /// remove the item of a handle and retrieve its value
+        /// @return false if the handle is stale
+        bool remove(Handle handle, T& item) {
+            T* p = find(handle);
+            if (p == nullptr) return false;
+            item = etl::move(*p);
+            return remove(handle);
+        }
+
+        /// remove all items, every outstanding handle becomes stale
+        void clear() {
+            for (auto index : owners) release_(index);
+            items.clear();
+            owners.clear();
+        }
+
+    private:
+        /// bump the generation of a slot and put it in the free list, unless the generation wraps around
+        void release_(U index) {
+            Slot& slot = slots.begin()[index];
+            slot.generation = (slot.generation + 1) & SlotHandle<U>::generation_mask;
+            if (slot.generation != 0) {
+                slot.position = freeHead;
+                freeHead = index;
+            }
+        }
+    };
+
+    /// type traits
+    template <typename T> struct is_slot_map : false_type {};
+    template <typename T, typename A, typename U> struct is_slot_map<SlotMap<T, A, U>> : true_type {};
+    template <typename T, typename A, typename U> struct is_slot_map<const SlotMap<T, A, U>> : true_type {};
+    template <typename T, typename A, typename U> struct is_slot_map<volatile SlotMap<T, A, U>> : true_type {};
+    template <typename T, typename A, typename U> struct is_slot_map<const volatile SlotMap<T, A, U>> : true_type {};
+    template <typename T> inline constexpr bool is_slot_map_v = is_slot_map<T>::value;
+
+    template <typename T, typename A, typename U> struct is_trivially_relocatable<SlotMap<T, A, U>> : true_type {};
+
+    template <typename T, typename A, typename U> struct remove_extent<SlotMap<T, A, U>> { typedef T type; };
+    template <typename T, typename A, typename U> struct remove_extent<const SlotMap<T, A, U>> { typedef T type; };
+    template <typename T, typename A, typename U> struct remove_extent<volatile SlotMap<T, A, U>> { typedef T type; };
+    template <typename T, typename A, typename U> struct remove_extent<const volatile SlotMap<T, A, U>> { typedef T type; };
+}
+
+#endif //ETL_SLOT_MAP_H
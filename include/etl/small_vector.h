@@ -0,0 +1,390 @@
+#ifndef ETL_SMALL_VECTOR_H
+#define ETL_SMALL_VECTOR_H
+
+#include "etl/vector.h"
+
+namespace Project::etl {
+
+    /// dynamic contiguous arrays that keep up to N items in an inline buffer.
+    /// the allocator is only used when the number of items exceeds N
+    template <typename T, size_t N, typename A = etl::Allocator<T>>
+    class SmallVector {
+        static_assert(N > 0, "inline capacity must not be zero");
+
+        T* buf;
+        size_t nItems = 0, capacity = N;
+        alignas(T) unsigned char storage[N * sizeof(T)];
+
+    public:
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef A Alloc;
+
+        /// empty constructor
+        SmallVector() : buf(inline_()) {}
+
+        /// construct and set the capacity
+        explicit SmallVector(size_t capacity) : SmallVector() { reserve(capacity); }
+
+        /// construct from initializer list
+        SmallVector(std::initializer_list<T>&& items) : SmallVector() {
+            reserve(items.size());
+            for (auto& it : items) emplace_back(etl::move(it));
+        }
+
+        /// copy constructor
+        SmallVector(const SmallVector& other) : SmallVector() { *this = other; }
+
+        /// move constructor
+        SmallVector(SmallVector&& other) noexcept : SmallVector() { *this = etl::move(other); }
+
+        /// copy assignment
+        SmallVector& operator=(const SmallVector& other) {
+            if (this == &other) return *this;
+
+            clear();
+            if (!reserve(other.nItems)) return *this;
+            for (auto& it : other) emplace_back(it);
+            return *this;
+        }
+
+        /// move assignment, the heap buffer is stolen, inline items are relocated to the inline buffer
+        SmallVector& operator=(SmallVector&& other) noexcept {
+            if (this == &other) return *this;
+
+            reset_delete_();
+            if (!other.is_inline()) {
+                buf = etl::exchange(other.buf, other.inline_());
+                nItems = etl::exchange(other.nItems, 0);
+                capacity = etl::exchange(other.capacity, N);
+                return *this;
+            }
+
+            detail::uninitialized_relocate(other.buf, other.nItems, buf);
+            nItems = etl::exchange(other.nItems, 0);
+            return *this;
+        }
+
+        /// destructor
+        ~SmallVector() noexcept { reset_delete_(); }
+
+        [[nodiscard]] size_t len() const { return nItems; }     ///< returns the number of items
+        [[nodiscard]] size_t size() const { return capacity; }  ///< returns the capacity
+
+        /// return true if the items are stored in the inline buffer
+        bool is_inline() const { return buf == inline_(); }
+
+        iterator data()   { return buf; }
+        iterator begin()  { return buf; }
+        iterator end()    { return buf + nItems; }
+        reference front() { return buf[0]; }
+        reference back()  { return buf[nItems - 1]; }
+
+        const_iterator data()   const { return buf; }
+        const_iterator begin()  const { return buf; }
+        const_iterator end()    const { return buf + nItems; }
+        const_reference front() const { return buf[0]; }
+        const_reference back()  const { return buf[nItems - 1]; }
+
+        /// get i-th item by dereference
+        /// @warning it will be error null dereference if index is not valid
+        reference operator[](int i) { return is_valid_index_(i) ? buf[i] : *static_cast<iterator>(nullptr); }
+        const_reference operator[](int i) const { return is_valid_index_(i) ? buf[i] : *static_cast<const_iterator>(nullptr); }
+
+        /// return forward iter object
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// return reversed iter object
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        /// add an item to the vector
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        void append(U&& other) { emplace_back(etl::forward<U>(other)); }
+
+        /// construct an item in place at the back of the vector
+        /// @retval pointer to the new item, null if the allocation fails
+        template <typename... Args>
+        iterator emplace_back(Args&&... args) {
+            if (!grow_(nItems + 1))
+                return nullptr;
+
+            auto ptr = new(buf + nItems) T(etl::forward<Args>(args)...);
+            ++nItems;
+            return ptr;
+        }
+
+        /// add all items in range [first, last) to this vector
+        /// @note the range may be a part of this vector if its iterators are pointers
+        template <typename Iterator, typename = enable_if_t<etl::is_iterator_v<Iterator>>>
+        void append(Iterator first, Iterator last) {
+            if constexpr (etl::has_operator_minus_v<Iterator>) {
+                const auto n = size_t(last - first);
+                if constexpr (etl::is_pointer_v<Iterator>) {
+                    if (n && is_item_address_(first)) {
+                        // the buffer may move when it grows, so the items are addressed by index
+                        const auto offset = size_t(first - begin());
+                        if (!grow_(nItems + n))
+                            return;
+                        for (size_t i = 0; i < n; ++i)
+                            emplace_back(buf[offset + i]);
+                        return;
+                    }
+                }
+                if (!grow_(nItems + n))
+                    return;
+            }
+            for (; first != last; ++first)
+                emplace_back(*first);
+        }
+
+        /// add all items from another vector to this vector, the other vector may be this vector
+        void append(const SmallVector& other) { append(other.begin(), other.end()); }
+
+        /// insert new item given the index
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        void insert(int index, U&& item) {
+            index = index >= 0 ? etl::min(index, int(nItems)) :
+                    int(nItems) + etl::max(index, -int(nItems));
+
+            if (index == int(nItems))
+                return append(etl::forward<U>(item));
+
+            if (!grow_(nItems + 1))
+                return;
+
+            detail::relocate_insert(buf, nItems, index, etl::forward<U>(item));
+            ++nItems;
+        }
+
+        /// insert another vector given the index
+        void insert(int index, const SmallVector& other) {
+            index = index >= 0 ? etl::min(index, int(nItems)) :
+                    int(nItems) + etl::max(index, -int(nItems));
+
+            if (this == &other)
+                return insert(index, SmallVector(other));
+
+            if (!grow_(nItems + other.nItems))
+                return;
+
+            detail::relocate_gap(buf, nItems, index, other.nItems);
+            for (size_t i = 0; i < other.nItems; ++i)
+                new(buf + index + i) T(other.buf[i]);
+            nItems += other.nItems;
+        }
+
+        /// insert another vector given the index
+        void insert(int index, SmallVector&& other) {
+            SmallVector other_ = etl::move(other);
+            index = index >= 0 ? etl::min(index, int(nItems)) :
+                    int(nItems) + etl::max(index, -int(nItems));
+
+            if (!grow_(nItems + other_.nItems))
+                return;
+
+            detail::relocate_gap(buf, nItems, index, other_.nItems);
+            detail::uninitialized_relocate(other_.buf, other_.nItems, buf + index);
+            nItems += other_.nItems;
+            other_.nItems = 0; // the items are relocated, skip their destructors
+        }
+
+        /// remove an item given the index
+        bool remove_at(int index) {
+            if (!is_valid_index_(index))
+                return false;
+
+            detail::relocate_erase(buf, nItems, index);
+            --nItems;
+            return true;
+        }
+
+        /// remove the first item found in the vector
+        bool remove(const_reference x) {
+            int index = etl::find(begin(), end(), x) - begin();
+            return remove_at(index);
+        }
+
+        /// set new capacity, return true if success. the capacity never goes below N
+        bool reserve(size_t newCapacity) {
+            newCapacity = etl::max(newCapacity, N);
+            if (newCapacity == capacity)
+                return true;
+
+            T* newBuf = newCapacity == N ? inline_() : allocate(newCapacity);
+            if (newBuf == nullptr)
+                return false;
+
+            auto n = etl::min(nItems, newCapacity);
+            detail::uninitialized_relocate(buf, n, newBuf);
+            for (size_t i = n; i < nItems; ++i)
+                buf[i].~T();
+
+            if (!is_inline())
+                deallocate(buf, capacity);
+
+            buf = newBuf;
+            nItems = n;
+            capacity = newCapacity;
+            return true;
+        }
+
+        /// set n items to 0, capacity remains the same
+        void clear() {
+            for (auto ptr = begin(); ptr != end(); ++ptr)
+                ptr->~T();
+            nItems = 0;
+        }
+
+        /// set n items, n must be less than n items, capacity remains the same
+        void resize(size_t n) {
+            for (size_t i = n; i < nItems; ++i)
+                buf[i].~T();
+
+            if (n < nItems) nItems = n;
+        }
+
+        /// shrink the capacity to fit the number of items, move the items back to the inline buffer if they fit
+        bool shrink() { return reserve(nItems); }
+
+        /// fill the gap with value, the nItems will be the same as capacity
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        void fill(U&& value) {
+            while (nItems < capacity) {
+                new(buf + nItems) T(etl::forward<U>(value));
+                ++nItems;
+            }
+        }
+
+        /// slice operator
+        Iter<iterator> operator()(int start, int stop, int step = 1) {
+            return (start < stop && step > 0) || (start > stop && step < 0) ?
+                etl::iter(&operator[](start), &operator[](stop), step) : // valid index
+                etl::iter(begin(), begin()); // invalid index
+        }
+
+        Iter<const_iterator> operator()(int start, int stop, int step = 1) const {
+            return (start < stop && step > 0) || (start > stop && step < 0) ?
+                etl::iter(&operator[](start), &operator[](stop), step) : // valid index
+                etl::iter(begin(), begin()); // invalid index
+        }
+
+        /// create new vector by adding an item
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        SmallVector operator+(U&& other) const {
+            SmallVector res(nItems + 1);
+            res.append(*this);
+            res.append(etl::forward<U>(other));
+            return res;
+        }
+
+        /// create new vector by adding another vector
+        SmallVector operator+(const SmallVector& other) const {
+            SmallVector res(nItems + other.nItems);
+            res.append(*this);
+            res.append(other);
+            return res;
+        }
+
+        /// create new vector by adding another vector
+        SmallVector operator+(SmallVector&& other) const {
+            SmallVector res(nItems + other.nItems);
+            res.append(*this);
+            res.insert(int(nItems), etl::move(other));
+            return res;
+        }
+
+        /// append operator
+        template <typename U>
+        SmallVector& operator+=(U&& other) { append(etl::forward<U>(other)); return *this; }
+
+    private:
+        T* inline_() { return reinterpret_cast<T*>(storage); }
+        const T* inline_() const { return reinterpret_cast<const T*>(storage); }
+
+        /// make sure the capacity can hold n items, grow geometrically once the inline buffer is exceeded
+        bool grow_(size_t n) {
+            if (n <= capacity)
+                return true;
+
+            auto newCapacity = capacity * ETL_VECTOR_GROWTH_NUMERATOR / ETL_VECTOR_GROWTH_DENOMINATOR;
+            return reserve(etl::max(n, newCapacity));
+        }
+
+        /// return true if p points to an item of this vector
+        bool is_item_address_(const T* p) const {
+            return reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(buf) < nItems * sizeof(T);
+        }
+
+        void reset_delete_() {
+            clear();
+            if (!is_inline())
+                deallocate(buf, capacity);
+            buf = inline_();
+            capacity = N;
+        }
+
+        bool is_valid_index_(int& index) const {
+            if (nItems == 0) return false;
+            if (index < 0) index = int(nItems) + index; // allowing negative index
+            if (index < 0 || size_t(index) >= nItems) return false; // out of range
+            return true;
+        }
+
+        static iterator allocate(size_t n) {
+            Alloc alloc;
+            return alloc.allocate(n);
+        }
+
+        static void deallocate(iterator ptr, size_t n) {
+            Alloc alloc;
+            alloc.deallocate(ptr, n);
+        }
+    };
+
+    /// create small vector with variadic template function, the type can be explicitly specified
+    template <typename T, size_t N, typename A = etl::Allocator<T>, typename... Ts> auto
+    small_vector(Ts&&...vals) { return SmallVector<T, N, A> { T(etl::forward<Ts>(vals))... }; }
+
+    /// convert any sequence to a small vector
+    template <typename T, size_t N, typename A = etl::Allocator<T>, typename Sequence> auto
+    small_vectorize(Sequence&& seq) {
+        auto res = SmallVector<T, N, A>();
+
+        if constexpr (etl::trait_len<Sequence>::value)
+            res.reserve(etl::len(seq));
+
+        if constexpr (etl::is_lvalue_reference_v<Sequence>) {
+            for (decltype(auto) item : seq)
+                res += item;
+        } else {
+            auto seq_ = etl::move(seq);
+            for (decltype(auto) item : seq_)
+                res += etl::move(item);
+        }
+
+        return res;
+    }
+
+    /// type traits
+    template <typename T> struct is_small_vector : false_type {};
+    template <typename T, size_t N, typename A> struct is_small_vector<SmallVector<T, N, A>> : true_type {};
+    template <typename T, size_t N, typename A> struct is_small_vector<const SmallVector<T, N, A>> : true_type {};
+    template <typename T, size_t N, typename A> struct is_small_vector<volatile SmallVector<T, N, A>> : true_type {};
+    template <typename T, size_t N, typename A> struct is_small_vector<const volatile SmallVector<T, N, A>> : true_type {};
+    template <typename T> inline constexpr bool is_small_vector_v = is_small_vector<T>::value;
+
+    template <typename T, size_t N, typename A> struct remove_extent<SmallVector<T, N, A>> { typedef T type; };
+    template <typename T, size_t N, typename A> struct remove_extent<const SmallVector<T, N, A>> { typedef T type; };
+    template <typename T, size_t N, typename A> struct remove_extent<volatile SmallVector<T, N, A>> { typedef T type; };
+    template <typename T, size_t N, typename A> struct remove_extent<const volatile SmallVector<T, N, A>> { typedef T type; };
+}
+
+#endif //ETL_SMALL_VECTOR_H
@@ -0,0 +1,187 @@
+#ifndef ETL_SPAN_H
+#define ETL_SPAN_H
+
+#include "etl/array.h"
+
+namespace Project::etl {
+    template <typename T, size_t Extent = dynamic_extent> class Span;
+}
+
+namespace Project::etl::detail {
+    /// element type of a contiguous sequence, i.e. its begin() is the pointer returned by data(), void otherwise
+    template <typename Sequence, typename = void>
+    struct span_element { typedef void type; };
+
+    template <typename Sequence>
+    struct span_element<Sequence, etl::void_t<decltype(etl::declval<Sequence&>().data()), decltype(etl::begin(etl::declval<Sequence&>()))>> {
+        typedef decltype(etl::declval<Sequence&>().data()) P;
+        typedef etl::conditional_t<etl::is_pointer_v<P> && etl::is_same_v<P, decltype(etl::begin(etl::declval<Sequence&>()))>,
+            etl::remove_pointer_t<P>, void> type;
+    };
+
+    /// number of elements known at compile time, dynamic_extent otherwise
+    template <typename Sequence> struct span_extent { static constexpr size_t value = dynamic_extent; };
+    template <typename T, size_t N> struct span_extent<Array<T, N>> { static constexpr size_t value = N; };
+    template <typename T, size_t N> struct span_extent<Span<T, N>> { static constexpr size_t value = N; };
+
+    /// elements of type U can be viewed as T, e.g. int as const int
+    template <typename U, typename T> struct is_span_convertible : etl::bool_constant<etl::is_convertible_v<U(*)[], T(*)[]>> {};
+    template <typename T> struct is_span_convertible<void, T> : etl::false_type {};
+    template <typename U, typename T> inline constexpr bool is_span_convertible_v = is_span_convertible<U, T>::value;
+}
+
+namespace Project::etl {
+
+    /// non-owning view of a contiguous sequence of elements.
+    /// Vector, Array, String, StringView and the other sequences whose iterator is a pointer convert to it implicitly,
+    /// and the algorithms copy, fill and find use memmove, memset and memchr on its pointers
+    /// @tparam Extent number of elements if known at compile time, or etl::dynamic_extent
+    /// @warning the span does not extend the lifetime of the sequence
+    template <typename T, size_t Extent>
+    class Span {
+        T* ptr = nullptr;
+        size_t length = Extent == dynamic_extent ? 0 : Extent;
+
+    public:
+        typedef etl::remove_const_volatile_t<T> value_type;
+        typedef T* iterator;
+        typedef T* const_iterator;
+        typedef T& reference;
+        typedef T& const_reference;
+
+        static constexpr size_t extent = Extent;
+
+        /// empty constructor
+        constexpr Span() = default;
+
+        /// construct from a pointer and the number of elements
+        /// @note the number of elements of a span with static extent is always Extent
+        constexpr Span(T* ptr, size_t n) : ptr(ptr), length(n) {}
+
+        /// construct from a C array
+        template <typename U, size_t N, typename = enable_if_t<
+            detail::is_span_convertible_v<U, T> && (Extent == dynamic_extent || Extent == N)>>
+        constexpr Span(U (&arr)[N]) : ptr(arr), length(N) {}
+
+        /// implicit constructor from a contiguous sequence whose size matches the extent
+        template <typename Sequence, typename S = etl::decay_t<Sequence>, typename = enable_if_t<
+            detail::is_span_convertible_v<typename detail::span_element<etl::remove_reference_t<Sequence>>::type, T> &&
+            (Extent == dynamic_extent || detail::span_extent<S>::value == Extent)>>
+        constexpr Span(Sequence&& seq) : ptr(seq.data()), length(etl::len(seq)) {}
+
+        /// explicit constructor of a span with static extent from a sequence of runtime size
+        template <typename Sequence, typename S = etl::decay_t<Sequence>, typename = enable_if_t<
+            detail::is_span_convertible_v<typename detail::span_element<etl::remove_reference_t<Sequence>>::type, T> &&
+            Extent != dynamic_extent && detail::span_extent<S>::value == dynamic_extent>, typename = void>
+        constexpr explicit Span(Sequence&& seq) : ptr(seq.data()), length(Extent) {}
+
+        [[nodiscard]] constexpr size_t len() const {
+            if constexpr (Extent != dynamic_extent) return Extent;
+            else return length;
+        }
+
+        /// number of bytes of the elements
+        [[nodiscard]] constexpr size_t size_bytes() const { return len() * sizeof(T); }
+
+        /// return true if the span has at least one element
+        constexpr explicit operator bool() const { return len() > 0; }
+
+        constexpr iterator data()   const { return ptr; }
+        constexpr iterator begin()  const { return ptr; }
+        constexpr iterator end()    const { return ptr + len(); }
+        constexpr reference front() const { return ptr[0]; }
+        constexpr reference back()  const { return ptr[len() - 1]; }
+
+        constexpr Iter<iterator> iter() const { return Iter(begin(), end(), 1); }
+        constexpr Iter<iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// element access, allowing negative index
+        /// @note the index is not checked
+        constexpr reference operator[](int i) const { return ptr[i < 0 ? i + int(len()) : i]; }
+
+        /// the first n elements, n is clamped to the length
+        constexpr Span<T> first(size_t n) const { return { ptr, etl::min(n, len()) }; }
+
+        /// the last n elements, n is clamped to the length
+        constexpr Span<T> last(size_t n) const { n = etl::min(n, len()); return { ptr + len() - n, n }; }
+
+        /// count elements starting at offset, or all of them if count is dynamic_extent. both are clamped to the length
+        constexpr Span<T> subspan(size_t offset, size_t count = dynamic_extent) const {
+            offset = etl::min(offset, len());
+            return { ptr + offset, etl::min(count, len() - offset) };
+        }
+
+        /// the first N elements as a span with static extent
+        template <size_t N> constexpr Span<T, N> first() const {
+            static_assert(Extent == dynamic_extent || N <= Extent, "Span is too short");
+            return { ptr, N };
+        }
+
+        /// the last N elements as a span with static extent
+        template <size_t N> constexpr Span<T, N> last() const {
+            static_assert(Extent == dynamic_extent || N <= Extent, "Span is too short");
+            return { ptr + len() - N, N };
+        }
+
+        /// contiguous slice, negative indices count from the end and both are clamped to the length
+        constexpr Span<T> operator()(int start, int stop) const {
+            const int n = int(len());
+            start = etl::clamp(start < 0 ? start + n : start, 0, n);
+            stop = etl::clamp(stop < 0 ? stop + n : stop, 0, n);
+            return start < stop ? Span<T>(ptr + start, size_t(stop - start)) : Span<T>(ptr, size_t(0));
+        }
+
+        /// slice operator with a step, the same as the slice operator of the other sequences
+        constexpr Iter<iterator> operator()(int start, int stop, int step) const {
+            if (step == 1) return operator()(start, stop).iter();
+            const int n = int(len());
+            if (start < 0) start += n;
+            if (stop < 0) stop += n;
+            return (start < stop && step > 0) || (start > stop && step < 0) ?
+                Iter(ptr + start, ptr + stop, step) : Iter(begin(), begin(), step);
+        }
+    };
+
+    /// view of the bytes of the elements
+    template <typename T, size_t Extent> auto
+    as_bytes(Span<T, Extent> s) {
+        constexpr size_t N = Extent == dynamic_extent ? dynamic_extent : Extent * sizeof(T);
+        return Span<const uint8_t, N>(reinterpret_cast<const uint8_t*>(s.data()), s.size_bytes());
+    }
+
+    /// writable view of the bytes of the elements
+    template <typename T, size_t Extent, typename = enable_if_t<!etl::is_const_v<T>>> auto
+    as_writable_bytes(Span<T, Extent> s) {
+        constexpr size_t N = Extent == dynamic_extent ? dynamic_extent : Extent * sizeof(T);
+        return Span<uint8_t, N>(reinterpret_cast<uint8_t*>(s.data()), s.size_bytes());
+    }
+
+    /// create span of a contiguous sequence, the extent is static if the size of the sequence is known at compile time
+    /// @code auto s = etl::span(vec).subspan(2, 4); @endcode
+    template <typename Sequence, typename T = typename detail::span_element<etl::remove_reference_t<Sequence>>::type,
+        typename = enable_if_t<!etl::is_same_v<T, void>>> constexpr auto
+    span(Sequence&& seq) { return Span<T, detail::span_extent<etl::decay_t<Sequence>>::value>(seq); }
+
+    /// create span of a C array
+    template <typename T, size_t N> constexpr auto
+    span(T (&arr)[N]) { return Span<T, N>(arr); }
+
+    /// create span of a pointer and the number of elements
+    template <typename T> constexpr auto
+    span(T* ptr, size_t n) { return Span<T>(ptr, n); }
+
+    /// type traits
+    template <typename T> struct is_span : false_type {};
+    template <typename T, size_t N> struct is_span<Span<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_span<const Span<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_span<volatile Span<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_span<const volatile Span<T, N>> : true_type {};
+    template <typename T> inline constexpr bool is_span_v = is_span<T>::value;
+
+    template <typename T, size_t N> struct remove_extent<Span<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const Span<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<volatile Span<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const volatile Span<T, N>> { typedef T type; };
+}
+
+#endif //ETL_SPAN_H
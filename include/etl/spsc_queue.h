@@ -0,0 +1,169 @@
+#ifndef ETL_SPSC_QUEUE_H
+#define ETL_SPSC_QUEUE_H
+
+#include "etl/algorithm.h"
+#include <atomic>
+#include <cstring> // memcpy
+#include <new>
+
+#ifndef ETL_CACHE_LINE_SIZE
+#define ETL_CACHE_LINE_SIZE 64
+#endif
+
+namespace Project::etl {
+
+    /// wait-free bounded single-producer single-consumer queue, the items are stored in place.
+    /// push functions may only be called from one thread and pop functions from one other thread
+    /// @tparam N capacity, has to be a power of two
+    /// @note each index lives on its own cache line together with the other side's index cached by its owner,
+    /// so the shared indexes are only touched when the cached value says the queue looks full or empty
+    template <typename T, size_t N>
+    class SpscQueue {
+        static_assert(N > 0 && (N & (N - 1)) == 0, "capacity has to be a power of two");
+        static constexpr size_t mask = N - 1;
+
+        struct alignas(ETL_CACHE_LINE_SIZE) Index {
+            std::atomic<size_t> value {0};
+            size_t cache = 0; ///< last observed value of the other side's index, only used by the owner
+        };
+
+        Index head; ///< read index, owned by the consumer
+        Index tail; ///< write index, owned by the producer
+        alignas(ETL_CACHE_LINE_SIZE) alignas(T) unsigned char storage[N * sizeof(T)];
+
+    public:
+        typedef T value_type;
+
+        /// empty constructor
+        SpscQueue() {}
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /// destructor, remaining items are destroyed
+        ~SpscQueue() { while (pop()); }
+
+        /// @retval number of items, only a snapshot if the other side is running
+        size_t len() const { return tail.value.load(std::memory_order_acquire) - head.value.load(std::memory_order_acquire); }
+
+        /// @retval capacity
+        static constexpr size_t size() { return N; }
+
+        /// construct an item in place at the back, producer only
+        /// @return 0: the queue is full, 1: success
+        template <typename... Args>
+        int emplace(Args&&... args) {
+            const size_t t = tail.value.load(std::memory_order_relaxed);
+            if (writable_(t) == 0)
+                return 0;
+
+            new(slot_(t)) T(etl::forward<Args>(args)...);
+            tail.value.store(t + 1, std::memory_order_release);
+            return 1;
+        }
+
+        /// push an item at the back, producer only
+        /// @return 0: the queue is full, 1: success
+        template <typename U>
+        int push(U&& item) { return emplace(etl::forward<U>(item)); }
+
+        /// push up to n items at the back with a single publication, producer only
+        /// @return number of pushed items
+        /// @note trivially copyable items are copied with at most two memcpy
+        size_t push_n(const T* src, size_t n) {
+            const size_t t = tail.value.load(std::memory_order_relaxed);
+            n = etl::min(n, writable_(t, n));
+
+            if constexpr (etl::is_trivially_copyable_v<T>) {
+                const size_t first = etl::min(n, N - (t & mask));
+                ::memcpy((void*)slot_(t), src, first * sizeof(T));
+                ::memcpy((void*)buf_(), src + first, (n - first) * sizeof(T));
+            } else {
+                for (size_t i = 0; i < n; ++i) new(slot_(t + i)) T(src[i]);
+            }
+
+            tail.value.store(t + n, std::memory_order_release);
+            return n;
+        }
+
+        /// get the oldest item without removing it, consumer only
+        /// @retval null if the queue is empty
+        T* front() {
+            const size_t h = head.value.load(std::memory_order_relaxed);
+            return readable_(h) ? slot_(h) : nullptr;
+        }
+
+        /// removes the oldest item and retrieves its value, consumer only
+        /// @return 0: the queue is empty, 1: success
+        int pop(T& item) {
+            const size_t h = head.value.load(std::memory_order_relaxed);
+            if (readable_(h) == 0)
+                return 0;
+
+            item = etl::move(*slot_(h));
+            slot_(h)->~T();
+            head.value.store(h + 1, std::memory_order_release);
+            return 1;
+        }
+
+        /// removes the oldest item, consumer only
+        /// @return 0: the queue is empty, 1: success
+        int pop() {
+            const size_t h = head.value.load(std::memory_order_relaxed);
+            if (readable_(h) == 0)
+                return 0;
+
+            slot_(h)->~T();
+            head.value.store(h + 1, std::memory_order_release);
+            return 1;
+        }
+
+        /// removes up to n oldest items with a single publication, consumer only
+        /// @return number of popped items
+        /// @note trivially copyable items are copied with at most two memcpy
+        size_t pop_n(T* dest, size_t n) {
+            const size_t h = head.value.load(std::memory_order_relaxed);
+            n = etl::min(n, readable_(h, n));
+
+            if constexpr (etl::is_trivially_copyable_v<T>) {
+                const size_t first = etl::min(n, N - (h & mask));
+                ::memcpy(dest, (const void*)slot_(h), first * sizeof(T));
+                ::memcpy(dest + first, (const void*)buf_(), (n - first) * sizeof(T));
+            } else {
+                for (size_t i = 0; i < n; ++i) {
+                    dest[i] = etl::move(*slot_(h + i));
+                    slot_(h + i)->~T();
+                }
+            }
+
+            head.value.store(h + n, std::memory_order_release);
+            return n;
+        }
+
+    private:
+        T* buf_() { return reinterpret_cast<T*>(storage); }
+        T* slot_(size_t index) { return buf_() + (index & mask); }
+
+        /// number of free slots seen by the producer, the shared head is only loaded when the cached one is not enough
+        size_t writable_(size_t t, size_t wanted = 1) {
+            size_t free = N - (t - tail.cache);
+            if (free < wanted) {
+                tail.cache = head.value.load(std::memory_order_acquire);
+                free = N - (t - tail.cache);
+            }
+            return free;
+        }
+
+        /// number of items seen by the consumer, the shared tail is only loaded when the cached one is not enough
+        size_t readable_(size_t h, size_t wanted = 1) {
+            size_t n = head.cache - h;
+            if (n < wanted) {
+                head.cache = tail.value.load(std::memory_order_acquire);
+                n = head.cache - h;
+            }
+            return n;
+        }
+    };
+}
+
+#endif //ETL_SPSC_QUEUE_H
@@ -0,0 +1,140 @@
+#ifndef ETL_STATIC_MAP_H
+#define ETL_STATIC_MAP_H
+
+#include "etl/array.h"
+#include "etl/hash.h"
+#include "etl/string_view.h"
+
+namespace Project::etl {
+
+    /// immutable map from a fixed set of string keys, built in constexpr context.
+    /// the keys are placed with a minimal perfect hash: they are grouped into buckets by hash,
+    /// and every bucket gets a pilot value that scatters its keys into free slots of a table of exactly N slots.
+    /// a lookup is one hash of the key, one pilot read and one key comparison, there is no probing
+    /// @note the value type must be default constructible and copy assignable in constexpr context
+    /// @warning duplicate keys are a construction error: compilation fails in constexpr context, null dereference otherwise
+    template <typename V, size_t N>
+    class StaticMap {
+        static_assert(N > 0, "Static map needs at least one key");
+
+        static constexpr size_t B = N / 2 + 1; ///< number of buckets, two keys per bucket on average
+
+        Array<Pair<StringView, V>, N> items = {};
+        Array<uint32_t, B> pilots = {};
+
+    public:
+        typedef StringView Key;
+        typedef V Value;
+        typedef const Pair<StringView, V>* iterator;
+        typedef const Pair<StringView, V>* const_iterator;
+
+        /// construct from an array of key-value pairs, the pairs don't need to be sorted
+        constexpr explicit StaticMap(const Pair<StringView, V>(&pairs)[N]) { build_(pairs); }
+
+        [[nodiscard]] static constexpr size_t len() { return N; } ///< returns the number of pairs
+
+        /// iterate the pairs in slot order, not in the order of construction
+        constexpr const_iterator begin() const { return items.begin(); }
+        constexpr const_iterator end()   const { return items.end(); }
+
+        constexpr Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// check if a key is in this map
+        constexpr bool has(const StringView& key) const { return find(key) != nullptr; }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        constexpr const V& get(const StringView& key) const { return *find(key); }
+
+        /// get a value given the key
+        /// @warning it will throw error null dereference if key does not exist
+        constexpr const V& operator[](const StringView& key) const { return *find(key); }
+
+        constexpr const V* find(const StringView& key) const {
+            const uint64_t h = detail::hash_bytes(key.data(), key.len());
+            const auto& item = items[int(slot_(h, pilots[int(h % B)]))];
+            return item.x == key ? &item.y : nullptr;
+        }
+
+    private:
+        static constexpr size_t slot_(uint64_t h, uint32_t pilot) {
+            return size_t(detail::hash_mix(h ^ (pilot * 0x9e37'79b9'7f4a'7c15ull)) % N);
+        }
+
+        /// place the buckets from the biggest to the smallest, each one with the first pilot that
+        /// sends all of its keys to distinct free slots. big buckets are placed while the table is still empty
+        constexpr void build_(const Pair<StringView, V>(&pairs)[N]) {
+            uint64_t hashes[N] = {};
+            size_t sizes[B] = {};
+            size_t maxSize = 0;
+            for (size_t i = 0; i < N; ++i) {
+                hashes[i] = detail::hash_bytes(pairs[i].x.data(), pairs[i].x.len());
+                const size_t size = ++sizes[hashes[i] % B];
+                if (size > maxSize) maxSize = size;
+            }
+
+            // the keys grouped by bucket
+            size_t starts[B + 1] = {};
+            for (size_t b = 0; b < B; ++b) starts[b + 1] = starts[b] + sizes[b];
+
+            size_t members[N] = {};
+            size_t fill[B] = {};
+            for (size_t i = 0; i < N; ++i) {
+                const size_t b = hashes[i] % B;
+                members[starts[b] + fill[b]++] = i;
+            }
+
+            bool taken[N] = {};
+            size_t slots[N] = {};
+            for (size_t size = maxSize; size > 0; --size) for (size_t b = 0; b < B; ++b) {
+                if (sizes[b] != size) continue;
+                const size_t* bucket = members + starts[b];
+
+                // keys with the same full hash can never be separated
+                for (size_t j = 0; j < size; ++j) for (size_t k = j + 1; k < size; ++k) {
+                    if (hashes[bucket[j]] == hashes[bucket[k]]) fail_();
+                }
+
+                for (uint32_t pilot = 0;; ++pilot) {
+                    if (pilot == uint32_t(-1)) fail_();
+
+                    size_t j = 0;
+                    for (; j < size; ++j) {
+                        slots[j] = slot_(hashes[bucket[j]], pilot);
+                        if (taken[slots[j]]) break;
+                        taken[slots[j]] = true;
+                    }
+                    if (j == size) {
+                        pilots[int(b)] = pilot;
+                        for (j = 0; j < size; ++j) items[int(slots[j])] = pairs[bucket[j]];
+                        break;
+                    }
+                    while (j-- > 0) taken[slots[j]] = false;
+                }
+            }
+        }
+
+        /// not a constant expression, it makes the construction fail to compile in constexpr context
+        static void fail_() { *static_cast<volatile int*>(nullptr) = 0; }
+    };
+
+    /// create static map from an array of key-value pairs, the value type is explicitly specified
+    /// @code constexpr auto commands = etl::static_map<int>({{"start", 1}, {"stop", 2}}); @endcode
+    template <typename V, size_t N> constexpr auto
+    static_map(const Pair<StringView, V>(&pairs)[N]) { return StaticMap<V, N>(pairs); }
+
+    /// type traits
+    template <typename T> struct is_static_map : false_type {};
+    template <typename V, size_t N> struct is_static_map<StaticMap<V, N>> : true_type {};
+    template <typename V, size_t N> struct is_static_map<const StaticMap<V, N>> : true_type {};
+    template <typename V, size_t N> struct is_static_map<volatile StaticMap<V, N>> : true_type {};
+    template <typename V, size_t N> struct is_static_map<const volatile StaticMap<V, N>> : true_type {};
+    template <typename T> inline constexpr bool is_static_map_v = is_static_map<T>::value;
+
+    template <typename V, size_t N> struct remove_extent<StaticMap<V, N>> { typedef Pair<StringView, V> type; };
+    template <typename V, size_t N> struct remove_extent<const StaticMap<V, N>> { typedef Pair<StringView, V> type; };
+    template <typename V, size_t N> struct remove_extent<volatile StaticMap<V, N>> { typedef Pair<StringView, V> type; };
+    template <typename V, size_t N> struct remove_extent<const volatile StaticMap<V, N>> { typedef Pair<StringView, V> type; };
+}
+
+#endif //ETL_STATIC_MAP_H
@@ -0,0 +1,235 @@
+#ifndef ETL_STATIC_VECTOR_H
+#define ETL_STATIC_VECTOR_H
+
+#include "etl/algorithm.h"
+#include "etl/memory.h"
+
+namespace Project::etl {
+
+    /// contiguous arrays with runtime length and compile-time capacity, the items are stored in place.
+    /// no dynamic memory allocation, adding items fails when the vector is full
+    template <typename T, size_t N>
+    class StaticVector {
+        alignas(T) unsigned char storage[N * sizeof(T) > 0 ? N * sizeof(T) : 1];
+        size_t nItems = 0;
+
+    public:
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef T& reference;
+        typedef const T& const_reference;
+
+        /// empty constructor
+        constexpr StaticVector() {}
+
+        /// construct from initializer list, excess items are discarded
+        StaticVector(std::initializer_list<T>&& items) {
+            for (auto& it : items) if (!emplace_back(etl::move(it))) break;
+        }
+
+        /// copy constructor
+        StaticVector(const StaticVector& other) { *this = other; }
+
+        /// move constructor
+        StaticVector(StaticVector&& other) noexcept { *this = etl::move(other); }
+
+        /// copy assignment
+        StaticVector& operator=(const StaticVector& other) {
+            if (this == &other) return *this;
+            clear();
+            for (auto& it : other) emplace_back(it);
+            return *this;
+        }
+
+        /// move assignment
+        StaticVector& operator=(StaticVector&& other) noexcept {
+            if (this == &other) return *this;
+            clear();
+            for (auto& it : other) emplace_back(etl::move(it));
+            other.clear();
+            return *this;
+        }
+
+        /// destructor
+        ~StaticVector() noexcept { clear(); }
+
+        [[nodiscard]] size_t len() const { return nItems; }         ///< returns the number of items
+        [[nodiscard]] static constexpr size_t size() { return N; }  ///< returns the capacity
+
+        /// return true if no more item can be added
+        bool is_full() const { return nItems == N; }
+
+        iterator data()   { return buf_(); }
+        iterator begin()  { return buf_(); }
+        iterator end()    { return buf_() + nItems; }
+        reference front() { return buf_()[0]; }
+        reference back()  { return buf_()[nItems - 1]; }
+
+        const_iterator data()   const { return buf_(); }
+        const_iterator begin()  const { return buf_(); }
+        const_iterator end()    const { return buf_() + nItems; }
+        const_reference front() const { return buf_()[0]; }
+        const_reference back()  const { return buf_()[nItems - 1]; }
+
+        /// get i-th item by dereference
+        /// @warning it will be error null dereference if index is not valid
+        reference operator[](int i) { return is_valid_index_(i) ? buf_()[i] : *static_cast<iterator>(nullptr); }
+        const_reference operator[](int i) const { return is_valid_index_(i) ? buf_()[i] : *static_cast<const_iterator>(nullptr); }
+
+        /// return forward iter object
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// return reversed iter object
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// return true if not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        /// add an item to the vector
+        /// @return false if the vector is full
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        bool append(U&& other) { return emplace_back(etl::forward<U>(other)) != nullptr; }
+
+        /// construct an item in place at the back of the vector
+        /// @retval pointer to the new item, null if the vector is full
+        template <typename... Args>
+        iterator emplace_back(Args&&... args) {
+            if (nItems == N)
+                return nullptr;
+
+            auto ptr = new(buf_() + nItems) T(etl::forward<Args>(args)...);
+            ++nItems;
+            return ptr;
+        }
+
+        /// add all items in range [first, last) to this vector
+        /// @return false if not all items fit, the items that fit are still added
+        template <typename Iterator, typename = enable_if_t<etl::is_iterator_v<Iterator>>>
+        bool append(Iterator first, Iterator last) {
+            for (; first != last; ++first)
+                if (!emplace_back(*first)) return false;
+            return true;
+        }
+
+        /// add all items from another vector to this vector
+        /// @return false if not all items fit, the items that fit are still added
+        template <size_t M>
+        bool append(const StaticVector<T, M>& other) { return append(other.begin(), other.end()); }
+
+        /// insert new item given the index
+        /// @return false if the vector is full
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        bool insert(int index, U&& item) {
+            index = index >= 0 ? etl::min(index, int(nItems)) :
+                    int(nItems) + etl::max(index, -int(nItems));
+
+            if (index == int(nItems))
+                return append(etl::forward<U>(item));
+
+            if (nItems == N)
+                return false;
+
+            detail::relocate_insert(buf_(), nItems, index, etl::forward<U>(item));
+            ++nItems;
+            return true;
+        }
+
+        /// remove an item given the index
+        bool remove_at(int index) {
+            if (!is_valid_index_(index))
+                return false;
+
+            detail::relocate_erase(buf_(), nItems, index);
+            --nItems;
+            return true;
+        }
+
+        /// remove the first item found in the vector
+        bool remove(const_reference x) {
+            int index = etl::find(begin(), end(), x) - begin();
+            return remove_at(index);
+        }
+
+        /// the capacity is fixed, return true if it can hold the requested capacity
+        static constexpr bool reserve(size_t capacity) { return capacity <= N; }
+
+        /// set n items to 0
+        void clear() {
+            for (auto ptr = begin(); ptr != end(); ++ptr)
+                ptr->~T();
+            nItems = 0;
+        }
+
+        /// set n items, n must be less than n items
+        void resize(size_t n) {
+            for (size_t i = n; i < nItems; ++i)
+                buf_()[i].~T();
+
+            if (n < nItems) nItems = n;
+        }
+
+        /// fill the gap with value, the nItems will be the same as capacity
+        template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
+        void fill(U&& value) {
+            while (nItems < N) {
+                new(buf_() + nItems) T(etl::forward<U>(value));
+                ++nItems;
+            }
+        }
+
+        /// slice operator
+        Iter<iterator> operator()(int start, int stop, int step = 1) {
+            return (start < stop && step > 0) || (start > stop && step < 0) ?
+                etl::iter(&operator[](start), &operator[](stop), step) : // valid index
+                etl::iter(begin(), begin()); // invalid index
+        }
+
+        Iter<const_iterator> operator()(int start, int stop, int step = 1) const {
+            return (start < stop && step > 0) || (start > stop && step < 0) ?
+                etl::iter(&operator[](start), &operator[](stop), step) : // valid index
+                etl::iter(begin(), begin()); // invalid index
+        }
+
+        /// append operator, the item is discarded if the vector is full
+        template <typename U>
+        StaticVector& operator+=(U&& other) { append(etl::forward<U>(other)); return *this; }
+
+    private:
+        T* buf_() { return reinterpret_cast<T*>(storage); }
+        const T* buf_() const { return reinterpret_cast<const T*>(storage); }
+
+        bool is_valid_index_(int& index) const {
+            if (nItems == 0) return false;
+            if (index < 0) index = int(nItems) + index; // allowing negative index
+            if (index < 0 || size_t(index) >= nItems) return false; // out of range
+            return true;
+        }
+    };
+
+    /// create static vector with variadic template function, the type can be explicitly specified
+    template <typename T, size_t N, typename... Ts> auto
+    static_vector(Ts&&...vals) {
+        static_assert(sizeof...(Ts) <= N, "too many items");
+        return StaticVector<T, N> { T(etl::forward<Ts>(vals))... };
+    }
+
+    /// type traits
+    template <typename T> struct is_static_vector : false_type {};
+    template <typename T, size_t N> struct is_static_vector<StaticVector<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_static_vector<const StaticVector<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_static_vector<volatile StaticVector<T, N>> : true_type {};
+    template <typename T, size_t N> struct is_static_vector<const volatile StaticVector<T, N>> : true_type {};
+    template <typename T> inline constexpr bool is_static_vector_v = is_static_vector<T>::value;
+
+    template <typename T, size_t N> struct is_trivially_relocatable<StaticVector<T, N>> : is_trivially_relocatable<T> {};
+
+    template <typename T, size_t N> struct remove_extent<StaticVector<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const StaticVector<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<volatile StaticVector<T, N>> { typedef T type; };
+    template <typename T, size_t N> struct remove_extent<const volatile StaticVector<T, N>> { typedef T type; };
+}
+
+#endif //ETL_STATIC_VECTOR_H
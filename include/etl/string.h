@@ -192,6 +192,12 @@ namespace Project::etl {
         constexpr bool 
         operator!=(const char* other) const { return !operator==(other); }
 
+        template <size_t M> constexpr bool
+        operator<(const String<M>& other) const { return StringView(*this) < StringView(other); }
+
+        constexpr bool 
+        operator<(StringView other) const { return StringView(*this) < other; }
+
         constexpr auto 
         substr(int start, size_t length) const { return StringView(&operator[](start), length); }
 
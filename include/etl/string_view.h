@@ -106,6 +106,12 @@ namespace Project::etl {
             return !operator==(other); 
         }
 
+        /// lexicographical order, a prefix is less than the longer string
+        constexpr bool operator<(const StringView& other) const { return less(*this, other); }
+        constexpr bool operator>(const StringView& other) const { return less(other, *this); }
+        constexpr bool operator<=(const StringView& other) const { return !less(other, *this); }
+        constexpr bool operator>=(const StringView& other) const { return !less(*this, other); }
+
         /* substring */
 
         /// create a substring
@@ -172,6 +178,14 @@ namespace Project::etl {
         StringMatch<N> match(StringView format, StringView separator = "%s") const;
     
     private:
+        static constexpr bool less(const StringView& a, const StringView& b) {
+            const auto min_len = a.length < b.length ? a.length : b.length;
+            for (size_t i = 0; i < min_len; ++i) {
+                if (a.str[i] != b.str[i]) return uint8_t(a.str[i]) < uint8_t(b.str[i]);
+            }
+            return a.length < b.length;
+        }
+
         static constexpr size_t calculate_length(const char* text) {
             if (text == nullptr) return 0;
             size_t length = 0;
@@ -289,6 +303,8 @@ namespace Project::etl {
     template <> struct remove_extent<volatile StringView> { typedef char type; };
     template <> struct remove_extent<const volatile StringView> { typedef char type; };
 
+    template <> struct is_trivially_relocatable<StringView> : true_type {};
+
     constexpr bool operator==(const char* str, const StringView& other) { 
         return StringView(str) == other;
     }
@@ -38,6 +38,9 @@ namespace Project::etl {
     template <typename X, typename Y = X>
     struct Pair { X x; Y y; };
 
+    template <typename X, typename Y> struct is_trivially_relocatable<Pair<X, Y>> 
+        : etl::bool_constant<etl::is_trivially_relocatable_v<X> && etl::is_trivially_relocatable_v<Y>> {};
+
     /// create pair, types are deduced
     template <typename X, typename Y> constexpr auto
     pair(X&& x, Y&& y) { return etl::Pair<X, Y>{etl::forward<X>(x), etl::forward<Y>(y)}; }
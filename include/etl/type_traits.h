@@ -250,6 +250,14 @@ namespace Project::etl {
     template <typename T> struct is_floating_point<const volatile T> : etl::is_floating_point<T> {};
     template <typename T> inline constexpr bool is_floating_point_v = etl::is_floating_point<T>::value;
 
+    /// is_enum
+    template <typename T> struct is_enum : etl::bool_constant<__is_enum(T)> {};
+    template <typename T> inline constexpr bool is_enum_v = etl::is_enum<T>::value;
+
+    /// underlying_type
+    template <typename T> struct underlying_type { typedef __underlying_type(T) type; };
+    template <typename T> using underlying_type_t = typename etl::underlying_type<T>::type;
+
     /// is_void
     template <typename T> struct is_void       : etl::false_type {};
     template <>           struct is_void<void> : etl::true_type {};
@@ -447,6 +455,48 @@ namespace Project::etl {
     template <typename T> struct is_destructible : etl::bool_constant<etl::is_compound_v<T> && !etl::is_pointer_v<T>> {};
     template <typename T> inline constexpr bool is_destructible_v = etl::is_destructible<T>::value;
 
+    // is_trivially_copyable
+    template <typename T> struct is_trivially_copyable : etl::bool_constant<__is_trivially_copyable(T)> {};
+    template <typename T> inline constexpr bool is_trivially_copyable_v = etl::is_trivially_copyable<T>::value;
+
+    // is_trivially_destructible
+#if defined(__has_builtin)
+#if __has_builtin(__is_trivially_destructible)
+#define ETL_HAS_IS_TRIVIALLY_DESTRUCTIBLE
+#endif
+#endif
+#ifdef ETL_HAS_IS_TRIVIALLY_DESTRUCTIBLE
+    template <typename T> struct is_trivially_destructible : etl::bool_constant<__is_trivially_destructible(T)> {};
+#undef ETL_HAS_IS_TRIVIALLY_DESTRUCTIBLE
+#else
+    // gcc before 14 has no __is_trivially_destructible
+    template <typename T> struct is_trivially_destructible : etl::bool_constant<__has_trivial_destructor(T)> {};
+#endif
+    template <typename T> inline constexpr bool is_trivially_destructible_v = etl::is_trivially_destructible<T>::value;
+
+    // is_nothrow_move_constructible
+    template <typename T> struct is_nothrow_move_constructible : etl::bool_constant<__is_nothrow_constructible(T, T&&)> {};
+    template <typename T> inline constexpr bool is_nothrow_move_constructible_v = etl::is_nothrow_move_constructible<T>::value;
+
+    /// is_trivially_relocatable
+    /// true if moving an object to a new address and ending the lifetime of the source is equivalent to memcpy.
+    /// specialize this trait for user types that only own their resources through pointers
+    template <typename T> struct is_trivially_relocatable : etl::is_trivially_copyable<T> {};
+    template <typename T> struct is_trivially_relocatable<const T> : etl::is_trivially_relocatable<T> {};
+    template <typename T> struct is_trivially_relocatable<volatile T> : etl::false_type {};
+    template <typename T> struct is_trivially_relocatable<const volatile T> : etl::false_type {};
+    template <typename T> inline constexpr bool is_trivially_relocatable_v = etl::is_trivially_relocatable<T>::value;
+
+    /// is_constant_evaluated
+    /// true inside a constant evaluation. compilers without the builtin always take the constexpr-safe path
+    constexpr bool is_constant_evaluated() noexcept {
+#if defined(__GNUC__)
+        return __builtin_is_constant_evaluated();
+#else
+        return true;
+#endif
+    }
+
     // has_empty_constructor
     template <typename T>
     struct has_empty_constructor {
@@ -568,6 +618,9 @@ namespace Project::etl {
     /// trait json deserializer
     template <typename T, typename = void> struct trait_json_deserializer : etl::false_type {};
 
+    /// trait hash()
+    template <typename T, typename = void> struct trait_hash : etl::false_type {};
+
     // TODO
     template <typename T, typename U, typename = void> struct trait_eq : etl::false_type {};
 
@@ -1,19 +1,163 @@
 #ifndef ETL_UNORERED_MAP_H
 #define ETL_UNORERED_MAP_H
 
-#include "linked_list.h"
+#include "etl/allocator.h"
+#include "etl/algorithm.h"
+#include "etl/hash.h"
+#include "etl/bit.h"
+#include <cstring> // memset
+#include <new>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace Project::etl::detail {
+
+    /// group of 16 control bytes of an open addressing hash table.
+    /// a control byte is either empty, deleted, or the 7 lowest bits of the hash of a full slot
+    class HashControlGroup {
+        const int8_t* ctrl;
+
+    public:
+        static constexpr size_t width = 16;
+        static constexpr int8_t empty = -128;
+        static constexpr int8_t deleted = -2;
+
+        explicit HashControlGroup(const int8_t* ctrl) : ctrl(ctrl) {}
+
+        /// bit mask of the slots whose control byte equals h2
+        uint32_t match(int8_t h2) const {
+#if defined(__SSE2__)
+            auto group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), group)));
+#else
+            uint32_t res = 0;
+            for (size_t i = 0; i < width; ++i) res |= uint32_t(ctrl[i] == h2) << i;
+            return res;
+#endif
+        }
+
+        /// bit mask of the empty slots
+        uint32_t match_empty() const { return match(empty); }
+
+        /// bit mask of the empty or deleted slots
+        uint32_t match_empty_or_deleted() const {
+#if defined(__SSE2__)
+            return uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))));
+#else
+            uint32_t res = 0;
+            for (size_t i = 0; i < width; ++i) res |= uint32_t(ctrl[i] < 0) << i;
+            return res;
+#endif
+        }
+    };
+}
 
 namespace Project::etl {
 
-	template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>>
-	class UnorderedMap : public LinkedList<Pair<K, V>, A> {
-	public:
+    /// collection of key-value pairs with unique keys, implemented as open addressing hash table.
+    /// the pairs are stored contiguously in insertion order, and indexed by a table of control bytes
+    /// that is probed 16 slots at a time
+    /// @note removing a key moves the last pair to the position of the removed pair
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>>
+    class UnorderedMap {
+        static_assert(etl::trait_hash<K>::value, "Key type must be hashable, specialize etl::trait_hash for it");
+
+        typedef detail::HashControlGroup Group;
+        typedef etl::allocator_rebind_t<A, uint8_t> ByteAlloc;
+
+        Pair<K, V>* buf;
+        size_t nItems, capacity;
+        int8_t* ctrl;
+        uint32_t* slots;
+        size_t nSlots, nDeleted;
+
+    public:
         typedef K Key;
         typedef V Value;
+        typedef Pair<K, V> value_type;
+        typedef Pair<K, V>* iterator;
+        typedef const Pair<K, V>* const_iterator;
+        typedef Pair<K, V>& reference;
+        typedef const Pair<K, V>& const_reference;
+        typedef A Alloc;
+
+        /// empty constructor
+        constexpr UnorderedMap() : buf(nullptr), nItems(0), capacity(0), ctrl(nullptr), slots(nullptr), nSlots(0), nDeleted(0) {}
 
-		using LinkedList<Pair<K, V>, A>::LinkedList;
+        /// construct and reserve space for n items
+        explicit UnorderedMap(size_t n) : UnorderedMap() { reserve(n); }
 
-	    /// check if a key is in this map
+        /// construct from initializer list, the later pair wins if a key is duplicated
+        UnorderedMap(std::initializer_list<Pair<K, V>>&& items) : UnorderedMap() {
+            reserve(items.size());
+            for (auto& item : items) {
+                auto res = find(item.x);
+                if (res) *res = item.y;
+                else insert_(item.x, item.y);
+            }
+        }
+
+        /// copy constructor
+        UnorderedMap(const UnorderedMap& other) : UnorderedMap() { *this = other; }
+
+        /// move constructor
+        UnorderedMap(UnorderedMap&& other) noexcept : UnorderedMap() { *this = etl::move(other); }
+
+        /// copy assignment
+        UnorderedMap& operator=(const UnorderedMap& other) {
+            if (this == &other) return *this;
+            clear();
+            reserve(other.nItems);
+            for (auto& [x, y] : other) insert_(x, y);
+            return *this;
+        }
+
+        /// move assignment
+        UnorderedMap& operator=(UnorderedMap&& other) noexcept {
+            if (this == &other) return *this;
+            reset_delete_();
+            buf = etl::exchange(other.buf, nullptr);
+            nItems = etl::exchange(other.nItems, 0);
+            capacity = etl::exchange(other.capacity, 0);
+            ctrl = etl::exchange(other.ctrl, nullptr);
+            slots = etl::exchange(other.slots, nullptr);
+            nSlots = etl::exchange(other.nSlots, 0);
+            nDeleted = etl::exchange(other.nDeleted, 0);
+            return *this;
+        }
+
+        /// destructor
+        ~UnorderedMap() noexcept { reset_delete_(); }
+
+        [[nodiscard]] size_t len() const { return nItems; }     ///< returns the number of items
+        [[nodiscard]] size_t size() const { return capacity; }  ///< returns the number of items that can be held before rehashing
+
+        iterator data()   { return buf; }
+        iterator begin()  { return buf; }
+        iterator end()    { return buf + nItems; }
+        reference front() { return buf[0]; }
+        reference back()  { return buf[nItems - 1]; }
+
+        const_iterator data()   const { return buf; }
+        const_iterator begin()  const { return buf; }
+        const_iterator end()    const { return buf + nItems; }
+        const_reference front() const { return buf[0]; }
+        const_reference back()  const { return buf[nItems - 1]; }
+
+        /// return forward iter object
+        Iter<iterator> iter() { return Iter(begin(), end(), 1); }
+        Iter<const_iterator> iter() const { return Iter(begin(), end(), 1); }
+
+        /// return reversed iter object
+        Iter<iterator> reversed() { return Iter(end() - 1, begin() - 1, -1); }
+        Iter<const_iterator> reversed() const { return Iter(end() - 1, begin() - 1, -1); }
+
+        /// return true if the map is not empty
+        explicit operator bool() const { return nItems > 0; }
+
+        /// check if a key is in this map
         bool has(const K& key) const { return static_cast<bool>(find(key)); }
 
         /// get a value given the key
@@ -29,8 +173,8 @@ namespace Project::etl {
         V& operator[](KK&& key) {
             auto res = find(key);
             if (res) return *res;
-			this->push_back(etl::Pair<K, V>{etl::forward<KK>(key), Value{}});
-            return this->back().y;
+            auto item = insert_(etl::forward<KK>(key), Value{});
+            return item ? item->y : *static_cast<V*>(nullptr);
         }
 
         /// get a value given the key. if the key does not exist, return default constructed V
@@ -40,32 +184,192 @@ namespace Project::etl {
             static const auto v = Value{};
             return v;
         }
-        
+
         /// remove key-value pair given the key
         bool remove(const K& key) {
-            int index = 0;
-            for (auto& pair : *this) {
-                if (pair.x == key) break;
-                ++index;
+            auto slot = find_slot_(key, etl::hash(key));
+            if (slot == npos)
+                return false;
+
+            const uint32_t index = slots[slot];
+            const uint32_t last = uint32_t(nItems - 1);
+            ctrl[slot] = Group::deleted;
+            ++nDeleted;
+
+            if (index != last) {
+                slots[find_index_slot_(last)] = index;
+                buf[index] = etl::move(buf[last]);
             }
-            return this->pop_at(index);
+
+            buf[last].~Pair<K, V>();
+            --nItems;
+            return true;
         }
-    
+
         V* find(const K& key) {
-            V* res = nullptr;
-            for (auto &[x, y]: *this) if (x == key) res = &y;
-            return res;
+            auto slot = find_slot_(key, etl::hash(key));
+            return slot == npos ? nullptr : &buf[slots[slot]].y;
         }
 
         const V* find(const K& key) const {
-            const V* res = nullptr;
-            for (auto &[x, y]: *this) if (x == key) res = &y;
+            auto slot = find_slot_(key, etl::hash(key));
+            return slot == npos ? nullptr : &buf[slots[slot]].y;
+        }
+
+        /// make room for at least n items without rehashing, return true if success
+        bool reserve(size_t n) {
+            if (n <= capacity) return true;
+            return rehash_(slots_for_(n));
+        }
+
+        /// remove all items, the allocated memory remains
+        void clear() {
+            for (auto item = begin(); item != end(); ++item)
+                item->~Pair<K, V>();
+            if (ctrl) ::memset(ctrl, Group::empty, nSlots);
+            nItems = 0;
+            nDeleted = 0;
+        }
+
+    private:
+        static constexpr size_t npos = size_t(-1);
+        static constexpr size_t probe_next = size_t(-2);
+
+        static constexpr int8_t h2_(size_t hash) { return int8_t(hash & 0x7Fu); }
+        static constexpr size_t max_load_(size_t n) { return n - n / 8; }
+
+        static size_t slots_for_(size_t n) {
+            size_t res = Group::width;
+            while (max_load_(res) < n) res *= 2;
             return res;
         }
-	};
+
+        /// visit the groups in triangular number order until fn returns other than probe_next.
+        /// every group is visited since the number of groups is a power of 2
+        template <typename F>
+        size_t probe_(size_t hash, F&& fn) const {
+            const size_t mask = nSlots / Group::width - 1;
+            size_t group = (hash >> 7u) & mask;
+            for (size_t i = 1; ; ++i) {
+                auto res = fn(group * Group::width, Group(ctrl + group * Group::width));
+                if (res != probe_next) return res;
+                group = (group + i) & mask;
+            }
+        }
+
+        size_t find_slot_(const K& key, size_t hash) const {
+            if (nItems == 0) return npos;
+            return probe_(hash, [&](size_t offset, Group group) {
+                for (auto m = group.match(h2_(hash)); m; m &= m - 1) {
+                    auto slot = offset + etl::count_trailing_zeros(m);
+                    if (buf[slots[slot]].x == key) return slot;
+                }
+                return group.match_empty() ? npos : probe_next;
+            });
+        }
+
+        size_t find_index_slot_(uint32_t index) const {
+            const auto hash = etl::hash(buf[index].x);
+            return probe_(hash, [&](size_t offset, Group group) {
+                for (auto m = group.match(h2_(hash)); m; m &= m - 1) {
+                    auto slot = offset + etl::count_trailing_zeros(m);
+                    if (slots[slot] == index) return slot;
+                }
+                return probe_next;
+            });
+        }
+
+        size_t find_free_slot_(size_t hash) const {
+            return probe_(hash, [](size_t offset, Group group) {
+                auto m = group.match_empty_or_deleted();
+                return m ? offset + etl::count_trailing_zeros(m) : probe_next;
+            });
+        }
+
+        void set_slot_(size_t hash, uint32_t index) {
+            auto slot = find_free_slot_(hash);
+            if (ctrl[slot] == Group::deleted) --nDeleted;
+            ctrl[slot] = h2_(hash);
+            slots[slot] = index;
+        }
+
+        /// append new pair, the key must not exist in the map
+        template <typename KK, typename VV>
+        Pair<K, V>* insert_(KK&& key, VV&& value) {
+            if (nItems + nDeleted >= capacity) {
+                // grow if the table is at least half full, otherwise just purge the deleted slots
+                auto n = nSlots == 0 ? Group::width : nItems >= capacity / 2 ? nSlots * 2 : nSlots;
+                if (!rehash_(n)) return nullptr;
+            }
+
+            auto item = new(buf + nItems) Pair<K, V>{K(etl::forward<KK>(key)), V(etl::forward<VV>(value))};
+            set_slot_(etl::hash(item->x), uint32_t(nItems));
+            ++nItems;
+            return item;
+        }
+
+        bool rehash_(size_t newSlots) {
+            const size_t newCapacity = max_load_(newSlots);
+
+            ByteAlloc byteAlloc;
+            auto newCtrl = byteAlloc.allocate(newSlots + newSlots * sizeof(uint32_t));
+            if (!newCtrl) return false;
+
+            if (newCapacity != capacity) {
+                Alloc alloc;
+                auto newBuf = alloc.allocate(newCapacity);
+                if (!newBuf) {
+                    byteAlloc.deallocate(newCtrl, newSlots + newSlots * sizeof(uint32_t));
+                    return false;
+                }
+
+                for (size_t i = 0; i < nItems; ++i) {
+                    new(newBuf + i) Pair<K, V>(etl::move(buf[i]));
+                    buf[i].~Pair<K, V>();
+                }
+
+                alloc.deallocate(buf, capacity);
+                buf = newBuf;
+                capacity = newCapacity;
+            }
+
+            if (ctrl) byteAlloc.deallocate(reinterpret_cast<uint8_t*>(ctrl), nSlots + nSlots * sizeof(uint32_t));
+            ctrl = reinterpret_cast<int8_t*>(newCtrl);
+            slots = reinterpret_cast<uint32_t*>(newCtrl + newSlots);
+            nSlots = newSlots;
+            nDeleted = 0;
+
+            ::memset(ctrl, Group::empty, nSlots);
+            for (size_t i = 0; i < nItems; ++i)
+                set_slot_(etl::hash(buf[i].x), uint32_t(i));
+
+            return true;
+        }
+
+        void reset_delete_() {
+            for (auto item = begin(); item != end(); ++item)
+                item->~Pair<K, V>();
+
+            if (buf) {
+                Alloc alloc;
+                alloc.deallocate(buf, capacity);
+            }
+
+            if (ctrl) {
+                ByteAlloc byteAlloc;
+                byteAlloc.deallocate(reinterpret_cast<uint8_t*>(ctrl), nSlots + nSlots * sizeof(uint32_t));
+            }
+
+            buf = nullptr;
+            nItems = capacity = 0;
+            ctrl = nullptr;
+            slots = nullptr;
+            nSlots = nDeleted = 0;
+        }
+    };
 
     /// create map using variadic function, type is implicitly specified
-    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>, typename... Ks, typename... Vs, 
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>, typename... Ks, typename... Vs,
         typename = enable_if_t<(is_same_v<K, Ks> && ...) && (is_same_v<V, Vs> && ...)>> auto
     unordered_map(const Pair<K, V>& item, const Pair<Ks, Vs>&... items) { return UnorderedMap<K, V, A> { item, items... }; }
 
@@ -82,6 +386,10 @@ namespace Project::etl {
     template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> constexpr auto
     unordered_map() { return UnorderedMap<K, V, A> {}; }
 
+    /// create empty map, and reserve space for n items
+    template <typename K, typename V, typename A = etl::Allocator<Pair<K, V>>> auto
+    unordered_map_reserve(size_t n) { return UnorderedMap<K, V, A>(n); }
+
     /// type traits
     template <typename T> struct is_unordered_map : false_type {};
     template <typename K, typename V, typename A> struct is_unordered_map<UnorderedMap<K, V, A>> : true_type {};
@@ -90,6 +398,8 @@ namespace Project::etl {
     template <typename K, typename V, typename A> struct is_unordered_map<const volatile UnorderedMap<K, V, A>> : true_type {};
     template <typename T> inline constexpr bool is_unordered_map_v = is_unordered_map<T>::value;
 
+    template <typename K, typename V, typename A> struct is_trivially_relocatable<UnorderedMap<K, V, A>> : true_type {};
+
     template <typename K, typename V, typename A> struct remove_extent<UnorderedMap<K, V, A>> { typedef Pair<K, V> type; };
     template <typename K, typename V, typename A> struct remove_extent<const UnorderedMap<K, V, A>> { typedef Pair<K, V> type; };
     template <typename K, typename V, typename A> struct remove_extent<volatile UnorderedMap<K, V, A>> { typedef Pair<K, V> type; };
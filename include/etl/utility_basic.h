@@ -36,6 +36,9 @@ namespace Project::etl {
         return old;
     }
 
+    /// extent of a view that is only known at runtime
+    inline constexpr size_t dynamic_extent = size_t(-1);
+
     /// python-like len
     template <typename T> constexpr auto
     len(T&& t) { return etl::trait_len<etl::decay_t<T>>::len(etl::forward<T>(t)); }
@@ -0,0 +1,372 @@
+#ifndef ETL_VARIANT_H
+#define ETL_VARIANT_H
+
+#include "etl/utility_basic.h"
+#include <new>
+#include <variant> // std::bad_variant_access
+
+namespace Project::etl::detail {
+
+    /// smallest unsigned type that can hold the index of N alternatives
+    template <size_t N>
+    using variant_index_t = etl::conditional_t<(N <= 0xFF), uint8_t, etl::conditional_t<(N <= 0xFFFF), uint16_t, uint32_t>>;
+
+    /// index of the first alternative of type T, sizeof...(Ts) if not found
+    template <typename T, typename... Ts>
+    constexpr size_t variant_index_of() {
+        size_t res = 0;
+        bool found = false;
+        ((found = found || etl::is_same_v<T, Ts>, res += !found), ...);
+        return res;
+    }
+
+    template <size_t I, typename T, typename... Ts> struct variant_alternative { typedef typename variant_alternative<I - 1, Ts...>::type type; };
+    template <typename T, typename... Ts> struct variant_alternative<0, T, Ts...> { typedef T type; };
+
+    template <typename R, typename F, size_t I>
+    R variant_invoke(F& fn) { return fn(etl::integral_constant<size_t, I>{}); }
+
+    /// invoke fn with the index as an integral constant through a flat table of function pointers
+    template <typename R, typename F, size_t... Is>
+    R variant_dispatch(size_t index, F& fn, etl::index_sequence<Is...>) {
+        static constexpr R (*table[])(F&) = { &variant_invoke<R, F, Is>... };
+        return table[index](fn);
+    }
+
+    /// imaginary function F(T) for each alternative, the alternative constructed from U is chosen by overload resolution.
+    /// like std::variant, narrowing conversions are rejected and bool is only chosen for bool values
+    template <typename T> struct variant_narrow { T item[1]; };
+    template <size_t I> struct variant_unused {};
+
+    template <size_t I, typename T, typename U, typename = void>
+    struct variant_candidate { void operator()(variant_unused<I>) const; };
+
+    template <size_t I, typename T, typename U>
+    struct variant_candidate<I, T, U, etl::void_t<
+        etl::enable_if_t<!etl::is_same_v<etl::remove_const_volatile_t<T>, bool> || etl::is_same_v<etl::decay_t<U>, bool>>,
+        decltype(variant_narrow<T>{{ etl::declval<U>() }})
+    >> { etl::integral_constant<size_t, I> operator()(T) const; };
+
+    template <typename U, typename Seq, typename... Ts> struct variant_overload;
+    template <typename U, size_t... Is, typename... Ts>
+    struct variant_overload<U, etl::index_sequence<Is...>, Ts...> : variant_candidate<Is, Ts, U>... {
+        using variant_candidate<Is, Ts, U>::operator()...;
+    };
+
+    template <typename U, typename... Ts>
+    using variant_accepted_index = decltype(etl::declval<variant_overload<U, etl::index_sequence_for<Ts...>, Ts...>>()(etl::declval<U>()));
+
+    /// recursive union of the alternatives, so that the active member can be initialized in a constant expression
+    template <bool TriviallyDestructible, typename... Ts>
+    union variant_union {};
+
+    template <typename T, typename... Ts>
+    union variant_union<true, T, Ts...> {
+        char none;
+        T head;
+        variant_union<true, Ts...> tail;
+
+        constexpr variant_union() : none() {}
+
+        template <typename... Args>
+        constexpr explicit variant_union(etl::integral_constant<size_t, 0>, Args&&... args) : head(etl::forward<Args>(args)...) {}
+
+        template <size_t I, typename... Args>
+        constexpr explicit variant_union(etl::integral_constant<size_t, I>, Args&&... args)
+            : tail(etl::integral_constant<size_t, I - 1>(), etl::forward<Args>(args)...) {}
+    };
+
+    template <typename T, typename... Ts>
+    union variant_union<false, T, Ts...> {
+        char none;
+        T head;
+        variant_union<false, Ts...> tail;
+
+        constexpr variant_union() : none() {}
+
+        template <typename... Args>
+        constexpr explicit variant_union(etl::integral_constant<size_t, 0>, Args&&... args) : head(etl::forward<Args>(args)...) {}
+
+        template <size_t I, typename... Args>
+        constexpr explicit variant_union(etl::integral_constant<size_t, I>, Args&&... args)
+            : tail(etl::integral_constant<size_t, I - 1>(), etl::forward<Args>(args)...) {}
+
+        ~variant_union() {}
+    };
+
+    template <size_t I, typename U>
+    constexpr auto& variant_union_get(U& u) {
+        if constexpr (I == 0) return u.head;
+        else return variant_union_get<I - 1>(u.tail);
+    }
+
+    /// union of the alternatives and index, trivially copyable and destructible on its own.
+    /// the index is sizeof...(Ts) if the variant is valueless, i.e. constructing a new alternative threw
+    template <typename... Ts>
+    struct variant_storage {
+        typedef variant_union<(etl::is_trivially_destructible_v<Ts> && ...), Ts...> union_type;
+        static constexpr size_t npos = sizeof...(Ts);
+
+        union_type u;
+        variant_index_t<sizeof...(Ts)> idx;
+
+        constexpr variant_storage() : u(), idx(npos) {}
+
+        template <size_t I, typename... Args>
+        constexpr explicit variant_storage(etl::integral_constant<size_t, I> i, Args&&... args)
+            : u(i, etl::forward<Args>(args)...), idx(I) {}
+
+        template <size_t I> using alternative_t = typename variant_alternative<I, Ts...>::type;
+
+        template <size_t I> constexpr alternative_t<I>& at_() & { return variant_union_get<I>(u); }
+        template <size_t I> constexpr const alternative_t<I>& at_() const& { return variant_union_get<I>(u); }
+        template <size_t I> constexpr alternative_t<I>&& at_() && { return etl::move(at_<I>()); }
+
+        /// construct the I-th alternative, the variant has to be valueless
+        template <size_t I, typename... Args>
+        alternative_t<I>& construct_(Args&&... args) {
+            new(&u) union_type(etl::integral_constant<size_t, I>(), etl::forward<Args>(args)...);
+            idx = I;
+            return at_<I>();
+        }
+
+        /// destroy the active alternative, the variant is valueless afterwards
+        void destroy_() {
+            if constexpr (!(etl::is_trivially_destructible_v<Ts> && ...)) {
+                if (idx == npos) return;
+                auto fn = [this](auto i) {
+                    using T = alternative_t<decltype(i)::value>;
+                    this->template at_<decltype(i)::value>().~T();
+                };
+                variant_dispatch<void>(idx, fn, etl::index_sequence_for<Ts...>());
+            }
+            idx = npos;
+        }
+
+        template <typename V>
+        void construct_from_(V&& other) {
+            if (other.idx == npos) return;
+            auto fn = [this, &other](auto i) {
+                this->template construct_<decltype(i)::value>(etl::forward<V>(other).template at_<decltype(i)::value>());
+            };
+            variant_dispatch<void>(other.idx, fn, etl::index_sequence_for<Ts...>());
+        }
+    };
+
+    template <bool TriviallyDestructible, typename... Ts>
+    struct variant_destroy : variant_storage<Ts...> {
+        using variant_storage<Ts...>::variant_storage;
+    };
+
+    template <typename... Ts>
+    struct variant_destroy<false, Ts...> : variant_storage<Ts...> {
+        using variant_storage<Ts...>::variant_storage;
+
+        variant_destroy() = default;
+        variant_destroy(const variant_destroy&) = default;
+        variant_destroy(variant_destroy&&) = default;
+        variant_destroy& operator=(const variant_destroy&) = default;
+        variant_destroy& operator=(variant_destroy&&) = default;
+        ~variant_destroy() { this->destroy_(); }
+    };
+
+    template <bool TriviallyCopyable, typename... Ts>
+    struct variant_copy : variant_destroy<(etl::is_trivially_destructible_v<Ts> && ...), Ts...> {
+        using variant_destroy<(etl::is_trivially_destructible_v<Ts> && ...), Ts...>::variant_destroy;
+    };
+
+    template <typename... Ts>
+    struct variant_copy<false, Ts...> : variant_destroy<(etl::is_trivially_destructible_v<Ts> && ...), Ts...> {
+        using variant_destroy<(etl::is_trivially_destructible_v<Ts> && ...), Ts...>::variant_destroy;
+        static constexpr bool nothrow_move = (etl::is_nothrow_move_constructible_v<Ts> && ...);
+
+        variant_copy() = default;
+        ~variant_copy() = default;
+
+        variant_copy(const variant_copy& other) { this->construct_from_(other); }
+        variant_copy(variant_copy&& other) noexcept(nothrow_move) { this->construct_from_(etl::move(other)); }
+
+        /// the copy is made before the active alternative is destroyed, so a throwing copy leaves this unchanged
+        variant_copy& operator=(const variant_copy& other) {
+            if (this == &other) return *this;
+            variant_copy temp(other);
+            this->destroy_();
+            this->construct_from_(etl::move(temp));
+            return *this;
+        }
+
+        variant_copy& operator=(variant_copy&& other) noexcept(nothrow_move) {
+            if (this == &other) return *this;
+            this->destroy_();
+            this->construct_from_(etl::move(other));
+            return *this;
+        }
+    };
+
+    /// empty base that deletes the copy operations of the variant when an alternative is not copy constructible
+    template <bool Copyable>
+    struct variant_copyable {};
+
+    template <>
+    struct variant_copyable<false> {
+        variant_copyable() = default;
+        variant_copyable(const variant_copyable&) = delete;
+        variant_copyable(variant_copyable&&) = default;
+        variant_copyable& operator=(const variant_copyable&) = delete;
+        variant_copyable& operator=(variant_copyable&&) = default;
+    };
+}
+
+namespace Project::etl {
+
+    /// type-safe tagged union holding exactly one of the alternatives in place.
+    /// the index uses the smallest unsigned type that fits, and copying or destroying the variant is trivial
+    /// when it is trivial for all alternatives. the variant is only copyable when all alternatives are
+    /// @note visit() dispatches through a flat table of function pointers indexed by the active alternative
+    template <typename... Ts>
+    class Variant : detail::variant_copy<(etl::is_trivially_copyable_v<Ts> && ...), Ts...>,
+                    detail::variant_copyable<(etl::is_copy_constructible_v<Ts> && ...)> {
+        typedef detail::variant_copy<(etl::is_trivially_copyable_v<Ts> && ...), Ts...> base_type;
+
+        static_assert(sizeof...(Ts) > 0, "variant must have at least one alternative");
+        static_assert(!(etl::is_reference_v<Ts> || ...), "variant must have no reference alternative");
+        static_assert(!(etl::is_void_v<Ts> || ...), "variant must have no void alternative");
+
+        template <typename T>
+        static constexpr size_t index_of_ = detail::variant_index_of<T, Ts...>();
+
+    public:
+        typedef detail::variant_index_t<sizeof...(Ts)> index_type;
+
+        template <size_t I>
+        using alternative_t = typename detail::variant_alternative<I, Ts...>::type;
+
+        /// empty constructor, holds the value-initialized first alternative
+        constexpr Variant() : base_type(etl::integral_constant<size_t, 0>()) {}
+
+        /// construct the alternative selected by overload resolution
+        template <typename U, typename = etl::disable_if_t<etl::is_same_v<etl::decay_t<U>, Variant>>,
+            size_t I = detail::variant_accepted_index<U&&, Ts...>::value>
+        constexpr Variant(U&& value) : base_type(etl::integral_constant<size_t, I>(), etl::forward<U>(value)) {}
+
+        constexpr Variant(const Variant&) = default;
+        constexpr Variant(Variant&&) = default;
+        Variant& operator=(const Variant&) = default;
+        Variant& operator=(Variant&&) = default;
+
+        /// assign the alternative selected by overload resolution
+        template <typename U, typename = etl::disable_if_t<etl::is_same_v<etl::decay_t<U>, Variant>>,
+            size_t I = detail::variant_accepted_index<U&&, Ts...>::value>
+        Variant& operator=(U&& value) {
+            if (this->idx == I) {
+                this->template at_<I>() = etl::forward<U>(value);
+            } else {
+                alternative_t<I> temp(etl::forward<U>(value)); // a throwing conversion leaves this unchanged
+                this->destroy_();
+                this->template construct_<I>(etl::move(temp));
+            }
+            return *this;
+        }
+
+        /// @retval index of the active alternative
+        [[nodiscard]] constexpr size_t index() const { return this->idx; }
+
+        /// @retval true if constructing the new alternative threw during an assignment or emplace
+        [[nodiscard]] constexpr bool valueless_by_exception() const { return this->idx == base_type::npos; }
+
+        /// @retval true if the active alternative is T
+        template <typename T>
+        [[nodiscard]] constexpr bool holds() const {
+            static_assert(index_of_<T> < sizeof...(Ts), "the type is not an alternative of the variant");
+            return this->idx == index_of_<T>;
+        }
+
+        /// destroy the active alternative and construct the I-th alternative in place
+        /// @note the variant is valueless if the constructor throws
+        template <size_t I, typename... Args>
+        alternative_t<I>& emplace(Args&&... args) {
+            this->destroy_();
+            return this->template construct_<I>(etl::forward<Args>(args)...);
+        }
+
+        /// destroy the active alternative and construct T in place
+        template <typename T, typename... Args>
+        T& emplace(Args&&... args) { return emplace<index_of_<T>>(etl::forward<Args>(args)...); }
+
+        /// get the I-th alternative
+        /// @warning throws std::bad_variant_access, or null dereference without exceptions, if it is not active
+        template <size_t I> constexpr alternative_t<I>& get() & { return this->idx == I ? this->template at_<I>() : bad_access_<I>(); }
+        template <size_t I> constexpr const alternative_t<I>& get() const& { return this->idx == I ? this->template at_<I>() : bad_access_<I>(); }
+        template <size_t I> constexpr alternative_t<I>&& get() && { return etl::move(get<I>()); }
+
+        /// get the alternative of type T
+        /// @warning throws std::bad_variant_access, or null dereference without exceptions, if it is not active
+        template <typename T> constexpr T& get() & { return get<index_of_<T>>(); }
+        template <typename T> constexpr const T& get() const& { return get<index_of_<T>>(); }
+        template <typename T> constexpr T&& get() && { return etl::move(get<index_of_<T>>()); }
+
+        /// @retval pointer to the I-th alternative, null if it is not active
+        template <size_t I> constexpr alternative_t<I>* get_if() { return this->idx == I ? &this->template at_<I>() : nullptr; }
+        template <size_t I> constexpr const alternative_t<I>* get_if() const { return this->idx == I ? &this->template at_<I>() : nullptr; }
+
+        /// @retval pointer to the alternative of type T, null if it is not active
+        template <typename T> constexpr T* get_if() { return get_if<index_of_<T>>(); }
+        template <typename T> constexpr const T* get_if() const { return get_if<index_of_<T>>(); }
+
+        /// invoke fn with the active alternative
+        /// @note fn has to return the same type for all alternatives
+        /// @warning throws std::bad_variant_access, or null dereference without exceptions, if the variant is valueless
+        template <typename F> decltype(auto) visit(F&& fn) & { return visit_(*this, fn); }
+        template <typename F> decltype(auto) visit(F&& fn) const& { return visit_(*this, fn); }
+        template <typename F> decltype(auto) visit(F&& fn) && { return visit_(etl::move(*this), fn); }
+
+        bool operator==(const Variant& other) const {
+            if (this->idx != other.idx)
+                return false;
+            if (this->idx == base_type::npos)
+                return true;
+            auto fn = [this, &other](auto i) -> bool {
+                return this->template at_<decltype(i)::value>() == other.template at_<decltype(i)::value>();
+            };
+            return detail::variant_dispatch<bool>(this->idx, fn, etl::index_sequence_for<Ts...>());
+        }
+
+        bool operator!=(const Variant& other) const { return !operator==(other); }
+
+    private:
+        template <typename V, typename F>
+        static decltype(auto) visit_(V&& self, F& fn) {
+            using R = decltype(fn(etl::forward<V>(self).template at_<0>()));
+            if (self.idx == base_type::npos) self.template bad_access_<0>();
+            auto call = [&self, &fn](auto i) -> R {
+                return fn(etl::forward<V>(self).template at_<decltype(i)::value>());
+            };
+            return detail::variant_dispatch<R>(self.idx, call, etl::index_sequence_for<Ts...>());
+        }
+
+        template <size_t I>
+        alternative_t<I>& bad_access_() const {
+#if __cpp_exceptions
+            throw std::bad_variant_access();
+#else
+            return *static_cast<alternative_t<I>*>(nullptr);
+#endif
+        }
+    };
+
+    /// type traits
+    template <typename T> struct is_variant : false_type {};
+    template <typename... Ts> struct is_variant<Variant<Ts...>> : true_type {};
+    template <typename... Ts> struct is_variant<const Variant<Ts...>> : true_type {};
+    template <typename... Ts> struct is_variant<volatile Variant<Ts...>> : true_type {};
+    template <typename... Ts> struct is_variant<const volatile Variant<Ts...>> : true_type {};
+    template <typename T> inline constexpr bool is_variant_v = is_variant<T>::value;
+
+    template <typename... Ts> struct is_trivially_relocatable<Variant<Ts...>> : bool_constant<(is_trivially_relocatable_v<Ts> && ...)> {};
+
+    /// invoke fn with the active alternative of the variant
+    template <typename F, typename V, typename = etl::enable_if_t<etl::is_variant_v<etl::decay_t<V>>>>
+    decltype(auto) visit(F&& fn, V&& variant) { return etl::forward<V>(variant).visit(etl::forward<F>(fn)); }
+}
+
+#endif //ETL_VARIANT_H
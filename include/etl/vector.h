@@ -3,6 +3,16 @@
 
 #include "etl/allocator.h"
 #include "etl/algorithm.h"
+#include "etl/memory.h"
+
+/// vector capacity grows by ETL_VECTOR_GROWTH_NUMERATOR / ETL_VECTOR_GROWTH_DENOMINATOR when it is full
+#ifndef ETL_VECTOR_GROWTH_NUMERATOR
+#define ETL_VECTOR_GROWTH_NUMERATOR 3
+#endif
+
+#ifndef ETL_VECTOR_GROWTH_DENOMINATOR
+#define ETL_VECTOR_GROWTH_DENOMINATOR 2
+#endif
 
 namespace Project::etl {
 
@@ -120,32 +130,52 @@ namespace Project::etl {
 
         /// add an item to the vector
         template <typename U, typename = enable_if_t<is_convertible_v<decay_t<U>, T>>>
-        void append(U&& other) {
-            auto newCapacity = nItems + 1;
-            if (capacity < newCapacity && !reserve(newCapacity))
-                return;
+        void append(U&& other) { emplace_back(etl::forward<U>(other)); }
 
-            new(buf + nItems) T(etl::forward<U>(other));
+        /// construct an item in place at the back of the vector
+        /// @retval pointer to the new item, null if the allocation fails
+        template <typename... Args>
+        iterator emplace_back(Args&&... args) {
+            if (!grow_(nItems + 1))
+                return nullptr;
+
+            auto ptr = new(buf + nItems) T(etl::forward<Args>(args)...);
             ++nItems;
+            return ptr;
         }
 
-        /// add all items from another vector to this vector
-        void append(const Vector& other) {
-            auto newCapacity = nItems + etl::len(other);
-            if (capacity < newCapacity && !reserve(newCapacity)) 
-                return;
-            
-            auto ptr = end();
-            for (auto src = etl::begin(other); src != etl::end(other); ++src, ++ptr)
-                new(ptr) T(*src);
-
-            nItems = newCapacity;
+        /// add all items in range [first, last) to this vector
+        /// @note the capacity is reserved once if the distance of the iterators can be computed.
+        /// the range may be a part of this vector if its iterators are pointers
+        template <typename Iterator, typename = enable_if_t<etl::is_iterator_v<Iterator>>>
+        void append(Iterator first, Iterator last) {
+            if constexpr (etl::has_operator_minus_v<Iterator>) {
+                const auto n = size_t(last - first);
+                if constexpr (etl::is_pointer_v<Iterator>) {
+                    if (n && is_item_address_(first)) {
+                        // the buffer may move when it grows, so the items are addressed by index
+                        const auto offset = size_t(first - begin());
+                        if (!grow_(nItems + n))
+                            return;
+                        for (size_t i = 0; i < n; ++i)
+                            emplace_back(buf[offset + i]);
+                        return;
+                    }
+                }
+                if (!grow_(nItems + n))
+                    return;
+            }
+            for (; first != last; ++first)
+                emplace_back(*first);
         }
 
+        /// add all items from another vector to this vector, the other vector may be this vector
+        void append(const Vector& other) { append(other.begin(), other.end()); }
+
         /// add all items from another vector to this vector
         void append(Vector&& other) {
             auto newCapacity = nItems + etl::len(other);
-            if (capacity < newCapacity && !reserve(newCapacity)) 
+            if (!grow_(newCapacity)) 
                 return;
 
             auto ptr = end();
@@ -165,49 +195,30 @@ namespace Project::etl {
             if (index == int(nItems))
                 return append(etl::forward<U>(item));
 
-            auto newCapacity = nItems + 1;
-            if (capacity < newCapacity && !reserve(newCapacity)) 
+            if (!grow_(nItems + 1)) 
                 return;
 
-            new(buf + nItems) T(etl::move(buf[nItems - 1]));
-            for (int i = nItems - 1; i > index; --i) {
-                buf[i] = etl::move(buf[i - 1]);
-            }
-
-            buf[index] = T(etl::forward<U>(item));
+            detail::relocate_insert(buf, nItems, index, etl::forward<U>(item));
             ++nItems;
         }
 
-        /// insert another vector given the index
+        /// insert another vector given the index, the other vector may be this vector
         void insert(int index, const Vector& other) {
             index = index >= 0 ? etl::min(index, int(nItems)) :
                     int(nItems) + etl::max(index, -int(nItems));
 
             if (index == int(nItems))
                 return append(other);
+
+            if (this == &other)
+                return insert(index, Vector(other));
             
-            auto newCapacity = nItems + etl::len(other);
-            if (capacity < newCapacity && !reserve(newCapacity)) 
+            if (!grow_(nItems + etl::len(other))) 
                 return;
-            
-            // shift
-            for (int i = index; i < int(nItems); ++i) {
-                int idx = i + etl::len(other);
-                if (idx >= int(nItems))
-                    new(buf + idx) T(etl::move(buf[i]));
-                else
-                    buf[idx] = etl::move(buf[i]);
-            }
-
-            // copy
-            for (int i = 0; i < int(etl::len(other)); i++) {
-                int idx = i + index;
-                if (idx >= int(nItems))
-                    new(buf + idx) T(other[i]);
-                else
-                    buf[idx] = other[i];
-            }
 
+            detail::relocate_gap(buf, nItems, index, etl::len(other));
+            for (size_t i = 0; i < etl::len(other); ++i)
+                new(buf + index + i) T(other.buf[i]);
             nItems += etl::len(other);
         }
 
@@ -218,31 +229,15 @@ namespace Project::etl {
                     int(nItems) + etl::max(index, -int(nItems));
 
             if (index == int(nItems))
-                return append(etl::move(other));
+                return append(etl::move(other_));
             
-            auto newCapacity = nItems + etl::len(other);
-            if (capacity < newCapacity && !reserve(newCapacity)) 
+            if (!grow_(nItems + etl::len(other_))) 
                 return;
-            
-            // shift
-            for (int i = index; i < int(nItems); ++i) {
-                int idx = i + etl::len(other);
-                if (idx >= int(nItems))
-                    new(buf + idx) T(etl::move(buf[i]));
-                else
-                    buf[idx] = etl::move(buf[i]);
-            }
-
-            // move
-            for (int i = 0; i < int(etl::len(other)); i++) {
-                int idx = i + index;
-                if (idx >= int(nItems))
-                    new(buf + idx) T(etl::move(other[i]));
-                else
-                    buf[idx] = etl::move(other[i]);
-            }
 
-            nItems += etl::len(other);
+            detail::relocate_gap(buf, nItems, index, etl::len(other_));
+            detail::uninitialized_relocate(other_.buf, etl::len(other_), buf + index);
+            nItems += etl::len(other_);
+            other_.nItems = 0; // the items are relocated, skip their destructors
         }
 
         /// remove an item given the index
@@ -250,10 +245,7 @@ namespace Project::etl {
             if (!is_valid_index_(index)) 
                 return false;
 
-            buf[index].~T();
-            for (; index < int(nItems) - 1; ++index)
-                buf[index] = etl::move(buf[index + 1]);
-
+            detail::relocate_erase(buf, nItems, index);
             --nItems;
             return true;
         }
@@ -274,16 +266,7 @@ namespace Project::etl {
                 return true;
             }
 
-            auto newBuf = move_alloc_(newCapacity);
-            if (newBuf == nullptr) 
-                return false;
-            
-            for (size_t i = newCapacity; i < nItems; ++i) 
-                buf[i].~T();
-
-            deallocate(buf, capacity);
-            reset_(newBuf, etl::min(nItems, newCapacity), newCapacity);
-            return true;
+            return relocate_(newCapacity);
         }
 
         /// set n items to 0, capacity remains the same
@@ -385,14 +368,40 @@ namespace Project::etl {
             return temp;
         }
 
-        iterator move_alloc_(size_t newCapacity) {
-            auto temp = allocate(newCapacity);
-            if (!temp) return temp;
+        /// move the items to a buffer of new capacity, using the allocator's reallocate if it is provided and T is trivially relocatable.
+        /// the new buffer is obtained before any item is moved or destroyed, so a failed allocation keeps the items
+        bool relocate_(size_t newCapacity) {
+            auto n = etl::min(nItems, newCapacity);
+
+            if constexpr (etl::is_trivially_relocatable_v<T> && etl::detail::trait_has_reallocate<Alloc, T>::value) {
+                // only when no item is truncated, a failed reallocate must leave every item in place
+                if (buf && n == nItems) {
+                    Alloc alloc;
+                    auto newBuf = alloc.reallocate(buf, capacity, newCapacity);
+                    if (newBuf == nullptr) 
+                        return false;
+
+                    reset_(newBuf, n, newCapacity);
+                    return true;
+                }
+            }
 
-            auto src = begin();
-            for (auto dest = temp; dest != temp + newCapacity && src != end(); ++dest, ++src)
-                new(dest) T(etl::move(*src));
-            return temp;
+            auto newBuf = allocate(newCapacity);
+            if (newBuf == nullptr) 
+                return false;
+
+            detail::uninitialized_relocate(buf, n, newBuf);
+            for (size_t i = n; i < nItems; ++i) 
+                buf[i].~T();
+
+            deallocate(buf, capacity);
+            reset_(newBuf, n, newCapacity);
+            return true;
+        }
+
+        /// return true if p points to an item of this vector
+        bool is_item_address_(const T* p) const {
+            return buf && reinterpret_cast<uintptr_t>(p) - reinterpret_cast<uintptr_t>(buf) < nItems * sizeof(T);
         }
 
         void reset_(iterator ptr = nullptr, size_t n = 0, size_t cap = 0) {
@@ -409,6 +418,15 @@ namespace Project::etl {
             reset_(ptr, n, cap);
         }
 
+        /// make sure the capacity can hold n items, grow geometrically so that n appends cost amortized O(1) each
+        bool grow_(size_t n) {
+            if (n <= capacity)
+                return true;
+            
+            auto newCapacity = capacity * ETL_VECTOR_GROWTH_NUMERATOR / ETL_VECTOR_GROWTH_DENOMINATOR;
+            return reserve(etl::max(n, newCapacity));
+        }
+
         bool is_valid_index_(int& index) const {
             if (nItems == 0) return false;
             if (index < 0) index = int(nItems) + index; // allowing negative index
@@ -485,6 +503,8 @@ namespace Project::etl {
     template <typename T, typename A> struct is_vector<const volatile Vector<T, A>> : true_type {};
     template <typename T> inline constexpr bool is_vector_v = is_vector<T>::value;
 
+    template <typename T, typename A> struct is_trivially_relocatable<Vector<T, A>> : true_type {};
+
     template <typename T, typename A> struct remove_extent<Vector<T, A>> { typedef T type; };
     template <typename T, typename A> struct remove_extent<const Vector<T, A>> { typedef T type; };
     template <typename T, typename A> struct remove_extent<volatile Vector<T, A>> { typedef T type; };
@@ -101,3 +101,32 @@ TEST(Algorithm, MaxMinSumClamp) {
     EXPECT_EQ(clamp(0, 1, 3), 1);
     EXPECT_EQ(clamp(4, 1, 3), 3);
 }
+
+TEST(Algorithm, Sort) {
+    int a[200];
+    for (int i = 0; i < 200; ++i) a[i] = (i * 73) % 200;
+    sort(a);
+    for (int i = 0; i < 200; ++i) EXPECT_EQ(a[i], i);
+
+    sort(begin(a), end(a), Greater{});
+    for (int i = 0; i < 200; ++i) EXPECT_EQ(a[i], 199 - i);
+
+    int b[] = {3, 3, 1, 1, 1, 2};
+    sort(b);
+    val last = unique(begin(b), end(b));
+    EXPECT_EQ(last - b, 3);
+    EXPECT_EQ(b[0], 1);
+    EXPECT_EQ(b[1], 2);
+    EXPECT_EQ(b[2], 3);
+}
+
+TEST(Algorithm, BinarySearch) {
+    val a = array(1, 2, 2, 2, 5, 8);
+    EXPECT_EQ(lower_bound(a, 2) - a.begin(), 1);
+    EXPECT_EQ(upper_bound(a, 2) - a.begin(), 4);
+    EXPECT_EQ(lower_bound(a, 0) - a.begin(), 0);
+    EXPECT_EQ(lower_bound(a, 9) - a.begin(), 6);
+    EXPECT_EQ(upper_bound(a, 8) - a.begin(), 6);
+    EXPECT_TRUE(binary_search(a, 5));
+    EXPECT_FALSE(binary_search(a, 4));
+}
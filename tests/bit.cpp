@@ -19,4 +19,20 @@ TEST(Bit, Bit_Cast) {
     EXPECT_EQ(bit_cast<float>(u), f);
     EXPECT_EQ(bit_cast<float>(u), *reinterpret_cast<float *>(u));
     EXPECT_EQ(f, *reinterpret_cast<float *>(u));
-}
\ No newline at end of file
+}
+
+TEST(Bit, Count) {
+    static_assert(count_trailing_zeros(uint8_t(0b1000)) == 3);
+    static_assert(count_trailing_ones(uint16_t(0b0111)) == 3);
+    static_assert(count_leading_zero(uint8_t(0b0001'0000)) == 3);
+    static_assert(count_leading_ones(uint32_t(0xF000'0000u)) == 4);
+    static_assert(count_bits(uint64_t(0xFFFF'0000'0000'0001u)) == 17);
+
+    EXPECT_EQ(count_trailing_zeros(uint32_t(0)), 32u);
+    EXPECT_EQ(count_trailing_ones(uint8_t(0xFF)), 8u);
+    EXPECT_EQ(count_trailing_zeros(uint64_t(1) << 40), 40u);
+    EXPECT_EQ(count_leading_zero(uint64_t(0)), 64u);
+    EXPECT_EQ(count_leading_zero(uint16_t(1)), 15u);
+    EXPECT_EQ(bit_width(uint64_t(1) << 40), 41u);
+    EXPECT_EQ(bit_ceil(uint64_t(5)), 8u);
+}
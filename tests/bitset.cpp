@@ -0,0 +1,86 @@
+#include "etl/bitset.h"
+#include "etl/vector.h"
+#include <bitset>
+#include <random>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(Bitset, Basic) {
+    constexpr auto c = bitset<100>(1, 5, 99);
+    static_assert(c.count() == 3);
+    static_assert(c.test(99) && !c.test(98));
+    static_assert(c.find_first() == 1 && c.find_next(5) == 99 && c.find_next(99) == 100);
+    static_assert((c << 1).find_first() == 2 && (c << 1).count() == 2);
+    static_assert((~c).count() == 97);
+
+    var b = Bitset<70>();
+    EXPECT_FALSE(b);
+    EXPECT_EQ(b.find_first(), 70);
+
+    b.set(0).set(64).set(69).set(70); // the last one is out of range
+    EXPECT_EQ(b.count(), 3);
+    EXPECT_TRUE(b[64]);
+    b.flip(64).reset(0);
+    EXPECT_EQ(b.count(), 1);
+    EXPECT_EQ(b.find_first(), 69);
+
+    b.set();
+    EXPECT_TRUE(b.all());
+    EXPECT_EQ(b.count(), 70);
+    EXPECT_EQ(b.count(3, 67), 64);
+    b.flip();
+    EXPECT_TRUE(b.none());
+
+    var indices = Vector<size_t>();
+    for (val i : bitset<200>(3, 64, 128, 199)) indices += i;
+    EXPECT_EQ(indices, vector<size_t>(3, 64, 128, 199));
+    EXPECT_EQ(bitset<200>(3, 64, 128, 199).iter().len(), 4);
+
+    EXPECT_EQ(Bitset<8>(0x1FF).count(), 8);
+    EXPECT_EQ(Bitset<8>(0x0F) | Bitset<8>(0xF0), Bitset<8>(0xFF));
+}
+
+template <size_t N>
+static void against_std(std::mt19937_64& rng) {
+    var a = Bitset<N>(), b = Bitset<N>();
+    var x = std::bitset<N>(), y = std::bitset<N>();
+    for (size_t n = N / 3 + 1; n > 0; --n) {
+        size_t p = rng() % N, q = rng() % N;
+        a.set(p); x.set(p);
+        b.set(q); y.set(q);
+    }
+
+    val check = [](const Bitset<N>& u, const std::bitset<N>& v) {
+        EXPECT_EQ(u.count(), v.count());
+        for (size_t i in range(N)) ASSERT_EQ(u.test(i), v.test(i)) << i;
+    };
+
+    check(a & b, x & y);
+    check(a | b, x | y);
+    check(a ^ b, x ^ y);
+    check(~a, ~x);
+    for (size_t s : {0, 1, 5, 63, 64, 65, 130, int(N - 1), int(N)}) {
+        check(a << s, x << s);
+        check(a >> s, x >> s);
+    }
+
+    size_t n = 0;
+    for (size_t i : a) {
+        EXPECT_TRUE(x.test(i));
+        ++n;
+    }
+    EXPECT_EQ(n, x.count());
+    EXPECT_EQ(a == b, x == y);
+    EXPECT_EQ(a == Bitset<N>(a), true);
+}
+
+TEST(Bitset, AgainstStd) {
+    std::mt19937_64 rng(1);
+    against_std<1>(rng);
+    against_std<64>(rng);
+    against_std<129>(rng);
+    against_std<1000>(rng);
+    against_std<4096>(rng);
+}
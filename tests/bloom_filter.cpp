@@ -0,0 +1,104 @@
+#include "etl/bloom_filter.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include <cmath>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+template <typename F>
+static void test_filter(F& f, size_t n, double rate) {
+    for (size_t i = 0; i < n; ++i) EXPECT_TRUE(f.insert(i * 2));
+    for (size_t i = 0; i < n; ++i) EXPECT_TRUE(f.contains(i * 2)); // no false negatives
+
+    size_t falsePositives = 0;
+    for (size_t i = 0; i < n; ++i) falsePositives += f.contains(i * 2 + 1);
+    EXPECT_LT(double(falsePositives) / double(n), rate * 1.5);
+}
+
+TEST(BloomFilter, Basic) {
+    var f = BloomFilter<>(100000, 0.01);
+    EXPECT_TRUE(f);
+    EXPECT_EQ(f.hash_len(), 7);
+    test_filter(f, 100000, 0.01);
+
+    var g = BloomFilter<>(10, 0.01);
+    EXPECT_TRUE(g.insert(StringView("key")));
+    EXPECT_TRUE(g.contains("key"));
+    EXPECT_TRUE(g.contains(String<8>("key")));
+    g.clear();
+    EXPECT_FALSE(g.contains("key"));
+
+    var h = etl::move(g);
+    EXPECT_TRUE(h);
+    EXPECT_FALSE(g);
+    EXPECT_TRUE(g.contains("anything")); // no bits, maybe
+}
+
+TEST(BloomFilter, Blocked) {
+    var f = BlockedBloomFilter<>(100000, 0.01);
+    EXPECT_TRUE(f);
+    test_filter(f, 100000, 0.01);
+
+    var g = f;
+    for (size_t i = 0; i < 100000; ++i) EXPECT_TRUE(g.contains(i * 2));
+
+    var h = etl::move(g);
+    EXPECT_TRUE(h.contains(size_t(0)));
+    EXPECT_FALSE(g);
+}
+
+TEST(BloomFilter, Merge) {
+    var a = BlockedBloomFilter<>(1000, 0.01);
+    var b = BlockedBloomFilter<>(1000, 0.01);
+    for (int i in range(500)) a.insert(i);
+    for (int i in range(500, 1000)) b.insert(i);
+
+    a |= b;
+    for (int i in range(1000)) EXPECT_TRUE(a.contains(i));
+    EXPECT_FALSE(a.merge(BlockedBloomFilter<>(100000, 0.01)));
+
+    var c = BloomFilter<>(1000, 0.01);
+    var d = BloomFilter<>(1000, 0.01);
+    c.insert(1);
+    d.insert(2);
+    EXPECT_TRUE(c.merge(d));
+    EXPECT_TRUE(c.contains(1));
+    EXPECT_TRUE(c.contains(2));
+    EXPECT_FALSE(c.merge(BloomFilter<>(1000, 0.1)));
+}
+
+template <typename F>
+static void test_filter_hash32(F& f, size_t n, double rate) {
+    // the hash of a 32-bit target, the upper half of the probe hash is only filled by widening it
+    auto hash32 = [](size_t key) { return detail::bloom_hash(uint32_t(etl::hash(key))); };
+    for (size_t i = 0; i < n; ++i) EXPECT_TRUE(f.insert_hash(hash32(i * 2)));
+    for (size_t i = 0; i < n; ++i) EXPECT_TRUE(f.contains_hash(hash32(i * 2)));
+
+    size_t falsePositives = 0;
+    for (size_t i = 0; i < n; ++i) falsePositives += f.contains_hash(hash32(i * 2 + 1));
+    EXPECT_LT(double(falsePositives) / double(n), rate * 1.5);
+}
+
+TEST(BloomFilter, Hash32) {
+    size_t upper = 0;
+    for (uint32_t i = 0; i < 1000; ++i) upper += (detail::bloom_hash(i) >> 32) != 0;
+    EXPECT_GT(upper, 990);
+    EXPECT_EQ(detail::bloom_hash(uint64_t(0x1234'5678'9abc'def0ull)), 0x1234'5678'9abc'def0ull);
+
+    var f = BloomFilter<>(10000, 0.01);
+    test_filter_hash32(f, 10000, 0.01); // the probes are spread by the upper half
+
+    var g = BlockedBloomFilter<>(10000, 0.01);
+    test_filter_hash32(g, 10000, 0.01); // the blocks are chosen by the upper half
+}
+
+TEST(BloomFilter, InvalidRate) {
+    for (double rate : {0.0, -0.5, 1.0, 2.0, std::nan("")}) {
+        EXPECT_FALSE(BloomFilter<>(1000, rate));
+        EXPECT_FALSE(BlockedBloomFilter<>(1000, rate));
+    }
+    EXPECT_TRUE(BloomFilter<>(1000, 0.999));
+    EXPECT_TRUE(BlockedBloomFilter<>(1000, 0.999));
+}
@@ -0,0 +1,142 @@
+#include "etl/btree_map.h"
+#include "etl/string.h"
+#include "etl/json_serialize.h"
+#include "etl/json_deserialize.h"
+#include "etl/json_size_max.h"
+#include <map>
+#include <random>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(BTreeMap, Basic) {
+    var m = btree_map<String<8>, int>({{"c", 3}, {"a", 1}, {"b", 2}});
+    EXPECT_EQ(m.len(), 3);
+    EXPECT_TRUE(m.has("a"));
+    EXPECT_FALSE(m.has("d"));
+    EXPECT_EQ(m.get("b"), 2);
+    EXPECT_EQ(m.find("d"), nullptr);
+
+    EXPECT_FALSE(m.insert("a", 10)); // already exists
+    EXPECT_TRUE(m.insert("d", 4));
+    m["e"] = 5;
+    EXPECT_EQ(m["e"], 5);
+
+    val& c = m;
+    EXPECT_EQ(c["f"], 0); // not inserted
+    EXPECT_EQ(m.len(), 5);
+
+    var keys = Vector<String<8>>();
+    for (val& [k, v] : m) keys += k;
+    EXPECT_EQ(keys, vector<String<8>>("a", "b", "c", "d", "e"));
+
+    EXPECT_TRUE(m.remove("c"));
+    EXPECT_FALSE(m.remove("c"));
+    EXPECT_EQ(m.len(), 4);
+
+    m.clear();
+    EXPECT_FALSE(m);
+    EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(BTreeMap, Range) {
+    var m = btree_map<int, int>();
+    for (val i in range(0, 2000, 2)) m[i] = i * 10;
+
+    EXPECT_EQ(m.lower_bound(400).key(), 400);
+    EXPECT_EQ(m.lower_bound(401).key(), 402);
+    EXPECT_EQ(m.upper_bound(400).key(), 402);
+    EXPECT_EQ(m.lower_bound(5000), m.end());
+    EXPECT_EQ(m.lower_bound(-1), m.begin());
+
+    var r = m.range(5, 11);
+    EXPECT_EQ(r.len(), 3);
+    EXPECT_EQ(r().x, 6);
+    EXPECT_EQ(r().x, 8);
+    EXPECT_EQ(r().y, 100);
+    EXPECT_EQ(m.range(11, 5).len(), 0);
+
+    // crossing many leaves
+    EXPECT_EQ(m.range(100, 1100).len(), 500);
+    EXPECT_EQ(m.iter().len(), 1000);
+    EXPECT_EQ((*m.reversed()).x, 1998);
+
+    int prev = 2000;
+    for (val [k, v] : m.reversed()) {
+        EXPECT_EQ(k, prev - 2);
+        prev = k;
+    }
+    EXPECT_EQ(prev, 0);
+}
+
+TEST(BTreeMap, LoadSorted) {
+    var items = Vector<Pair<int, int>>();
+    for (val i in range(100000)) items += Pair<int, int>{i * 3, i};
+
+    var m = BTreeMap<int, int>();
+    EXPECT_TRUE(m.load_sorted(items));
+    EXPECT_EQ(m.len(), 100000);
+    EXPECT_EQ(m.get(2997), 999);
+    EXPECT_FALSE(m.has(2998));
+
+    // the tree built bottom-up keeps working with inserts and removes
+    for (val i in range(100000)) EXPECT_TRUE(m.insert(i * 3 + 1, -i));
+    for (val i in range(0, 100000, 2)) EXPECT_TRUE(m.remove(i * 3));
+    EXPECT_EQ(m.len(), 150000);
+
+    var b = m;
+    EXPECT_EQ(b.len(), m.len());
+    EXPECT_EQ(b.get(4), -1);
+
+    int n = 0, prev = -1;
+    for (val [k, v] : b) {
+        EXPECT_LT(prev, k);
+        prev = k;
+        ++n;
+    }
+    EXPECT_EQ(n, 150000);
+
+    items[5].x = 0;
+    EXPECT_FALSE(m.load_sorted(items)); // not sorted
+    EXPECT_FALSE(m);
+}
+
+TEST(BTreeMap, AgainstStd) {
+    std::mt19937 rng(1);
+    var m = BTreeMap<uint32_t, uint32_t>();
+    var s = std::map<uint32_t, uint32_t>();
+
+    for (int i in range(300000)) {
+        uint32_t key = rng() % 20000;
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(m.remove(key), s.erase(key) > 0);
+        } else {
+            EXPECT_EQ(m.insert(key, uint32_t(i)), s.emplace(key, uint32_t(i)).second);
+        }
+    }
+    ASSERT_EQ(m.len(), s.size());
+
+    var it = s.begin();
+    for (val [k, v] : m) {
+        EXPECT_EQ(k, it->first);
+        EXPECT_EQ(v, it->second);
+        ++it;
+    }
+
+    // remove everything so that the tree shrinks back to nothing
+    for (val& [k, v] : s) EXPECT_TRUE(m.remove(k));
+    EXPECT_FALSE(m);
+    EXPECT_EQ(m.begin(), m.end());
+}
+
+TEST(BTreeMap, Json) {
+    val m = btree_map<std::string, int>({{"b", 2}, {"a", 1}});
+    EXPECT_EQ(json::serialize(m), "{\"a\":1,\"b\":2}");
+    EXPECT_GE(json::size_max(m), json::serialize(m).size());
+
+    val n = json::deserialize<BTreeMap<std::string, int>>(R"({"z": 26, "y": 25})").unwrap();
+    EXPECT_EQ(len(n), 2);
+    EXPECT_EQ(n.begin().key(), "y");
+    EXPECT_EQ(n["z"], 26);
+}
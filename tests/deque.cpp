@@ -0,0 +1,98 @@
+#include "etl/deque.h"
+#include "etl/vector.h"
+#include "etl/string.h"
+#include "etl/filter.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(Deque, PushPop) {
+    var a = deque<int>(1, 2, 3);
+    EXPECT_EQ(a.len(), 3);
+
+    EXPECT_TRUE(a.push_front(0));
+    EXPECT_TRUE(a.push_back(4));
+    EXPECT_EQ(a.front(), 0);
+    EXPECT_EQ(a.back(), 4);
+    EXPECT_EQ(a[1], 1);
+    EXPECT_EQ(a[-1], 4);
+    EXPECT_EQ(&a[5], nullptr);
+
+    int x;
+    EXPECT_TRUE(a.pop_front(x));
+    EXPECT_EQ(x, 0);
+    EXPECT_TRUE(a.pop_back(x));
+    EXPECT_EQ(x, 4);
+    EXPECT_EQ(a, vector(1, 2, 3));
+
+    a.clear();
+    EXPECT_FALSE(a);
+    EXPECT_FALSE(a.pop());
+
+    a << 5 << 6;
+    a >> x;
+    EXPECT_EQ(x, 5);
+    EXPECT_EQ(a.len(), 1);
+}
+
+TEST(Deque, Stable) {
+    var a = Deque<String<16>>();
+    a.push_back(String<16>("middle"));
+    val p = &a.front();
+
+    // pushing enough items on both sides to allocate new blocks and grow the map many times
+    for (int i in range(10000)) {
+        a.emplace_back("back %d", i);
+        a.emplace_front("front %d", i);
+    }
+    EXPECT_EQ(a.len(), 20001);
+    EXPECT_EQ(p, &a[10000]);
+    EXPECT_EQ(*p, "middle");
+    EXPECT_EQ(a[0], "front 9999");
+    EXPECT_EQ(a[-1], "back 9999");
+
+    while (a.len() > 1) {
+        a.pop_back();
+        a.pop_front();
+    }
+    EXPECT_EQ(a.len(), 1);
+    EXPECT_EQ(p, &a.front());
+}
+
+TEST(Deque, Fifo) {
+    var a = Deque<int>();
+    int expected = 0;
+    for (int i in range(1000000)) {
+        a << i;
+        if (i % 3 == 2) {
+            int x;
+            a >> x >> x;
+            EXPECT_EQ(x, expected + 1);
+            expected += 2;
+        }
+    }
+    EXPECT_EQ(a.len(), 1000000 / 3 + 1);
+    EXPECT_EQ(a.front(), expected);
+}
+
+TEST(Deque, Iter) {
+    var a = Deque<int>();
+    for (int i in range(1000)) a.push_front(i);
+
+    EXPECT_EQ(etl::len(a.iter()), 1000);
+    EXPECT_EQ(vectorize(a(0, 4, 2)), vector(999, 997));
+    EXPECT_EQ(vectorize(a(-2, a.len())), vector(1, 0));
+    EXPECT_EQ(vectorize(a | filter(lambda (int x) { return x < 3; })), vector(2, 1, 0));
+    EXPECT_EQ(vectorize(a.reversed())[2], 2);
+
+    int sum = 0;
+    for (val x : a) sum += x;
+    EXPECT_EQ(sum, 999 * 1000 / 2);
+
+    var b = a;
+    EXPECT_EQ(b, a);
+    var c = etl::move(b);
+    EXPECT_EQ(c, a);
+    EXPECT_FALSE(b);
+}
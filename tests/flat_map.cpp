@@ -0,0 +1,91 @@
+#include "etl/flat_map.h"
+#include "etl/string.h"
+#include "etl/json_serialize.h"
+#include "etl/json_deserialize.h"
+#include "gtest/gtest.h"
+#include "etl/placeholder.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+using namespace Project::etl::literals;
+
+TEST(FlatMap, Initialize) {
+    var a = flat_map<String<8>, int>(); // empty map
+    EXPECT_EQ(a.begin(), none);
+    EXPECT_EQ(a.len(), 0);
+
+    var b = flat_map_reserve<String<8>, int>(10); // empty map with initial capacity
+    EXPECT_NE(b.begin(), none);
+    EXPECT_EQ(b.len(), 0);
+    EXPECT_EQ(b.size(), 10);
+
+    val c = flat_map(pair("one"s, 1), pair("two"s, 2), pair("three"s, 3)); // from variadic function
+    EXPECT_EQ(c.len(), 3);
+
+    // sorted by key
+    EXPECT_EQ(c.front().x, "one");
+    EXPECT_EQ(c.back().x, "two");
+    EXPECT_EQ(c["three"], 3);
+}
+
+TEST(FlatMap, Sorted) {
+    var m = flat_map<int, int>();
+    for (val i in range(100)) m[(i * 37) % 100] = i;
+    EXPECT_EQ(len(m), 100);
+
+    int prev = -1;
+    for (val [k, v] in m) {
+        EXPECT_LT(prev, k);
+        EXPECT_EQ((v * 37) % 100, k);
+        prev = k;
+    }
+
+    EXPECT_FALSE(m.insert(5, 0));
+    EXPECT_TRUE(m.insert(200, 0));
+    EXPECT_TRUE(m.remove(200));
+    EXPECT_FALSE(m.remove(200));
+    EXPECT_FALSE(m.has(200));
+}
+
+TEST(FlatMap, InsertBulk) {
+    var m = flat_map<int, int>({{3, 30}, {1, 10}});
+    val n = m.insert_bulk(vector(pair(5, 50), pair(3, 0), pair(2, 20), pair(5, 50), pair(4, 40)));
+    EXPECT_EQ(n, 3);
+    EXPECT_EQ(len(m), 5);
+    EXPECT_EQ(m[3], 30); // existing keys are not replaced
+
+    int i = 1;
+    for (val [k, v] in m) {
+        EXPECT_EQ(k, i);
+        EXPECT_EQ(v, i * 10);
+        ++i;
+    }
+}
+
+TEST(FlatMap, Range) {
+    var m = flat_map<int, int>();
+    for (val i in range(0, 20, 2)) m[i] = i;
+
+    EXPECT_EQ(m.lower_bound(4)->x, 4);
+    EXPECT_EQ(m.lower_bound(5)->x, 6);
+    EXPECT_EQ(m.upper_bound(4)->x, 6);
+    EXPECT_EQ(m.lower_bound(100), m.end());
+
+    var r = m.range(5, 11);
+    EXPECT_EQ(r.len(), 3);
+    EXPECT_EQ(r().x, 6);
+    EXPECT_EQ(r().x, 8);
+    EXPECT_EQ(r().x, 10);
+
+    EXPECT_EQ(m.range(11, 5).len(), 0);
+}
+
+TEST(FlatMap, Json) {
+    val m = flat_map<std::string, int>({{"b", 2}, {"a", 1}});
+    EXPECT_EQ(json::serialize(m), "{\"a\":1,\"b\":2}");
+
+    val n = json::deserialize<FlatMap<std::string, int>>(R"({"z": 26, "y": 25})").unwrap();
+    EXPECT_EQ(len(n), 2);
+    EXPECT_EQ(n.front().x, "y");
+    EXPECT_EQ(n["z"], 26);
+}
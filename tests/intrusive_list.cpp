@@ -0,0 +1,95 @@
+#include "etl/intrusive_list.h"
+#include "etl/vector.h"
+#include "etl/transform.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+namespace {
+    struct Timer {
+        int id;
+        IntrusiveListHook hook;
+        explicit Timer(int id) : id(id) {}
+    };
+
+    using TimerList = IntrusiveList<Timer, &Timer::hook>;
+
+    auto ids(const TimerList& l) {
+        return vectorize(transform(l, lambda (const Timer& t) { return t.id; }));
+    }
+}
+
+TEST(IntrusiveList, Push) {
+    Timer t0(0), t1(1), t2(2), t3(3), t4(4);
+    var a = TimerList(t1, t3);
+    a.push_front(t0);
+    a.push(t2, 2);
+    a << t4;
+
+    EXPECT_EQ(len(a), 5);
+    EXPECT_EQ(ids(a), vectorize(range(5)));
+    EXPECT_EQ(a.front().id, 0);
+    EXPECT_EQ(a.back().id, 4);
+    EXPECT_EQ(a[-2].id, 3);
+    EXPECT_EQ(&a[1], &t1); // no copy, no allocation
+    EXPECT_TRUE(t0.hook.is_linked());
+
+    EXPECT_EQ(a.push(t1), 0); // already linked
+    EXPECT_EQ(a.push(t1, 10), 0);
+    EXPECT_EQ(len(a), 5);
+}
+
+TEST(IntrusiveList, Remove) {
+    Timer t0(0), t1(1), t2(2), t3(3);
+    var a = TimerList(t0, t2);
+    a.insert_after(t0, t1);
+    a.insert_before(t0, t3);
+    EXPECT_EQ(ids(a), vector(3, 0, 1, 2));
+
+    EXPECT_EQ(a.remove(t1), 1);
+    EXPECT_EQ(a.remove(t1), 0);
+    EXPECT_FALSE(t1.hook.is_linked());
+    EXPECT_EQ(ids(a), vector(3, 0, 2));
+
+    EXPECT_EQ(a.pop_back(), &t2);
+    EXPECT_EQ(a.pop(), &t3);
+    EXPECT_EQ(a.pop_front(), &t0);
+    EXPECT_EQ(a.pop(), nullptr);
+    EXPECT_FALSE(a);
+
+    a << t2 << t1;
+    {
+        var b = etl::move(a);
+        EXPECT_EQ(len(a), 0);
+        EXPECT_EQ(ids(b), vector(2, 1));
+    }
+    EXPECT_FALSE(t1.hook.is_linked()); // the destructor unlinks all items
+    EXPECT_FALSE(t2.hook.is_linked());
+}
+
+TEST(IntrusiveList, Iter) {
+    Timer t[] = {Timer(0), Timer(1), Timer(2), Timer(3), Timer(4)};
+    var a = TimerList();
+    for (var& item in t) a << item;
+
+    int i = 4;
+    for (val& item in a.reversed()) EXPECT_EQ(item.id, i--);
+
+    val& c = a;
+    EXPECT_EQ(vectorize(transform(c(1, 4), lambda (const Timer& t) { return t.id; })), vector(1, 2, 3));
+    EXPECT_EQ(vectorize(transform(c(-1, 0, -2), lambda (const Timer& t) { return t.id; })), vector(4, 2));
+    EXPECT_EQ(vectorize(transform(c(-10, 2), lambda (const Timer& t) { return t.id; })), vector(0, 1));
+    EXPECT_EQ(vectorize(transform(c(3, 10), lambda (const Timer& t) { return t.id; })), vector(3, 4));
+    EXPECT_EQ(len(c(5, 2)), 0); // start at the end, not at the root
+    EXPECT_EQ(len(c(10, 2)), 0);
+    EXPECT_EQ(len(a.iter()), 5);
+    EXPECT_EQ(len(a.reversed()), 5);
+
+    TimerList::const_iterator it = a.begin();
+    EXPECT_EQ(it, c.begin());
+    EXPECT_EQ(it->id, 0);
+
+    for (var& item in a) item.id *= 10;
+    EXPECT_EQ(t[3].id, 30);
+}
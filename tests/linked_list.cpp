@@ -196,3 +196,66 @@ TEST(LinkedList, Constness) {
     EXPECT_TRUE(is_const_v<remove_reference_t<decltype(j[0])>>);
     EXPECT_TRUE(is_const_v<remove_reference_t<decltype(*(j + 1))>>);
 }
+
+TEST(LinkedList, PushPopBack) {
+    var a = list<int>();
+    for (int i = 0; i < 1'000'000; ++i) a.push_back(i); // constant time append
+    EXPECT_EQ(len(a), 1'000'000);
+    EXPECT_EQ(a.front(), 0);
+    EXPECT_EQ(a.back(), 999'999);
+
+    int item;
+    EXPECT_EQ(a.pop_back(item), 1);
+    EXPECT_EQ(item, 999'999);
+    EXPECT_EQ(a.back(), 999'998);
+    EXPECT_EQ(len(a), 999'999);
+
+    a.clear();
+    EXPECT_EQ(len(a), 0);
+    EXPECT_EQ(a.begin(), none);
+    EXPECT_EQ(a.tail(), none);
+    EXPECT_EQ(a.pop_back(), 0);
+
+    a.push_front(1);
+    a.push(2, 1);
+    a.push(0, 0);
+    EXPECT_EQ(a.push(3, 10), 0); // out of range
+    EXPECT_EQ(a, vectorize(range(3)));
+    EXPECT_EQ(a.back(), 2);
+    EXPECT_EQ(a.pop(), 1);
+    EXPECT_EQ(a.pop(), 1);
+    EXPECT_EQ(a.pop(), 1);
+    EXPECT_EQ(a.pop(), 0);
+}
+
+namespace {
+    size_t allocation_count = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        T* allocate(size_t n) { ++allocation_count; return Allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) { Allocator<T>().deallocate(p, n); }
+    };
+}
+
+TEST(LinkedList, Emplace) {
+    struct Point { 
+        int x, y; 
+        Point(int x, int y) : x(x), y(y) {}
+    };
+
+    allocation_count = 0;
+    var a = LinkedList<Point, CountingAllocator<Point>>();
+    a.emplace_back(1, 2);
+    a.emplace_back(3, 4);
+    a.emplace_front(-1, 0);
+    a.emplace(1, 10, 20);
+    EXPECT_EQ(a.emplace(10, 0, 0), 0); // out of range
+    EXPECT_EQ(allocation_count, 4); // a single allocation per item
+
+    EXPECT_EQ(len(a), 4);
+    EXPECT_EQ(a[0].x, -1);
+    EXPECT_EQ(a[1].y, 20);
+    EXPECT_EQ(a.tail()->x, 3);
+    EXPECT_EQ(a.back().y, 4);
+}
@@ -0,0 +1,130 @@
+#include "etl/lru_cache.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
+#include "etl/vector.h"
+#include <list>
+#include <random>
+#include <unordered_map>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(LruCache, Basic) {
+    var c = LruCache<StringView, int, 3>();
+    EXPECT_EQ(c.capacity(), 3);
+    c.put("a", 1);
+    c.put("b", 2);
+    c.put("c", 3);
+    EXPECT_EQ(c.get("a"), 1); // a is now the most recently used
+
+    c.put("d", 4); // evicts b
+    EXPECT_FALSE(c.has("b"));
+    EXPECT_EQ(c.find("b"), nullptr);
+    EXPECT_EQ(c.evictions(), 1);
+    EXPECT_EQ(c.len(), 3);
+
+    EXPECT_EQ(*c.put("c", 30), 30); // assign, c is now the most recently used
+    c.put("e", 5); // evicts a
+    EXPECT_FALSE(c.has("a"));
+    EXPECT_EQ(*c.peek("c"), 30);
+
+    var keys = Vector<StringView>();
+    c.foreach([&](StringView k, int) { keys += k; });
+    EXPECT_EQ(keys, vector<StringView>("e", "c", "d"));
+
+    EXPECT_EQ(c.hits(), 1);
+    EXPECT_EQ(c.misses(), 1);
+    c.reset_stats();
+    EXPECT_EQ(c.hits(), 0);
+
+    EXPECT_TRUE(c.remove("d"));
+    EXPECT_FALSE(c.remove("d"));
+    c.put("f", 6); // takes the removed entry, nothing is evicted
+    EXPECT_EQ(c.evictions(), 0);
+    EXPECT_EQ(c.len(), 3);
+
+    c.clear();
+    EXPECT_FALSE(c);
+    EXPECT_FALSE(c.has("e"));
+}
+
+TEST(LruCache, AgainstReference) {
+    // reference lru on std containers
+    constexpr size_t capacity = 100;
+    std::list<int> order;
+    std::unordered_map<int, std::pair<int, std::list<int>::iterator>> ref;
+
+    var c = LruCache<int, int>(capacity);
+    std::mt19937 rng(5);
+    for (int i in range(200000)) {
+        int key = int(rng() % 300);
+        if (rng() % 4 == 0) {
+            EXPECT_EQ(c.remove(key), ref.erase(key) > 0 ? (order.remove(key), true) : false);
+            continue;
+        }
+
+        auto it = ref.find(key);
+        auto p = c.find(key);
+        ASSERT_EQ(p != nullptr, it != ref.end());
+        if (p) {
+            EXPECT_EQ(*p, it->second.first);
+            order.erase(it->second.second);
+            order.push_front(key);
+            it->second.second = order.begin();
+        } else {
+            if (ref.size() == capacity) {
+                ref.erase(order.back());
+                order.pop_back();
+            }
+            order.push_front(key);
+            ref[key] = {i, order.begin()};
+            c.put(key, i);
+        }
+        ASSERT_EQ(c.len(), ref.size());
+    }
+    EXPECT_GT(c.hits(), 0);
+    EXPECT_GT(c.evictions(), 0);
+}
+
+TEST(ClockCache, Basic) {
+    var c = ClockCache<int, String<8>>(3);
+    c.put(1, String<8>("one"));
+    c.put(2, String<8>("two"));
+    c.put(3, String<8>("three"));
+    EXPECT_EQ(c.get(1), "one"); // 1 gets a second chance
+
+    c.put(4, String<8>("four")); // the hand passes 1 and evicts 2
+    EXPECT_TRUE(c.has(1));
+    EXPECT_FALSE(c.has(2));
+    EXPECT_EQ(c.evictions(), 1);
+
+    c.put(5, String<8>("five")); // 1 has lost its reference bit, 3 is evicted before it
+    EXPECT_FALSE(c.has(3));
+    EXPECT_TRUE(c.has(1));
+
+    EXPECT_TRUE(c.remove(4));
+    c.put(6, String<8>("six"));
+    EXPECT_EQ(c.len(), 3);
+
+    int n = 0;
+    c.foreach([&](int, const String<8>&) { ++n; });
+    EXPECT_EQ(n, 3);
+}
+
+TEST(ClockCache, Random) {
+    var c = ClockCache<uint32_t, uint32_t, 256>();
+    std::mt19937 rng(9);
+    for (int i in range(200000)) {
+        uint32_t key = rng() % 1000;
+        if (var p = c.find(key)) {
+            EXPECT_EQ(*p, key * 2);
+        } else {
+            c.put(key, key * 2);
+        }
+        if (i % 7 == 0) c.remove(rng() % 1000);
+        ASSERT_LE(c.len(), 256);
+    }
+    EXPECT_GT(c.hits(), 0);
+    EXPECT_GT(c.evictions(), 0);
+}
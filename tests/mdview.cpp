@@ -0,0 +1,98 @@
+#include "etl/mdview.h"
+#include "etl/array.h"
+#include "etl/vector.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(MdView, Basic) {
+    var buf = vector_allocate<int>(12);
+    for (int i in range(12)) buf[i] = i;
+
+    val m = mdview<dynamic_extent, 4>(buf, 3);
+    static_assert(decltype(m)::rank() == 2 && decltype(m)::rank_dynamic() == 1);
+    EXPECT_EQ(m.extent(0), 3);
+    EXPECT_EQ(m.extent(1), 4);
+    EXPECT_EQ(m.stride(0), 4);
+    EXPECT_EQ(m.size(), 12);
+    EXPECT_EQ(m.len(), 3);
+    EXPECT_EQ(m(2, 1), 9);
+    EXPECT_EQ(m[1][3], 7);
+
+    m(0, 0) = 100;
+    EXPECT_EQ(buf[0], 100);
+
+    // iterating yields the rows
+    int sum = 0;
+    for (val row : m) for (val x : row) sum += x;
+    EXPECT_EQ(sum, 100 + 66);
+    EXPECT_EQ(m.iter().len(), 3);
+
+    val c = mdview_column_major<dynamic_extent, dynamic_extent>(buf.data(), 3, 4);
+    EXPECT_EQ(c.stride(0), 1);
+    EXPECT_EQ(c.stride(1), 3);
+    EXPECT_EQ(c(1, 2), 7);
+    EXPECT_EQ(c[1][2], 7);
+
+    val cm = MdView<const int, 3, 4>(buf.data());
+    var values = Vector<int>();
+    cm.foreach([&](int x) { values += x; });
+    EXPECT_EQ(values.len(), 12);
+    EXPECT_EQ(values[5], 5);
+
+    values.clear();
+    c.foreach([&](int x) { values += x; }); // memory order
+    EXPECT_EQ(values[5], 5);
+}
+
+TEST(MdView, Array) {
+    static constexpr auto arr = array<int>(1, 2, 3, 4, 5, 6, 7, 8);
+    constexpr auto m = mdview<2, 2, 2>(arr);
+    static_assert(m(1, 0, 1) == 6);
+    static_assert(m.size() == 8);
+
+    val row = m[1];
+    EXPECT_EQ(row(1, 1), 8);
+    EXPECT_EQ(row.rank(), 2);
+}
+
+TEST(MdView, Subview) {
+    var buf = vector_allocate<int>(5 * 6);
+    for (int i in range(30)) buf[i] = i;
+    val m = mdview<5, 6>(buf);
+
+    // column 2, a strided one-dimensional view
+    val col = m.subview(full_extent, 2);
+    EXPECT_EQ(col.rank(), 1);
+    EXPECT_EQ(col.len(), 5);
+    EXPECT_EQ(col.stride(0), 6);
+    var values = Vector<int>();
+    for (val x : col) values += x;
+    EXPECT_EQ(values, vector(2, 8, 14, 20, 26));
+
+    // slice operator over the strided iterator
+    var s = col(1, 4);
+    EXPECT_EQ(s.len(), 3);
+    EXPECT_EQ(s(), 8);
+    EXPECT_EQ(s(), 14);
+    EXPECT_EQ(*col.reversed(), 26);
+
+    // rows 1 and 3, every other column from 1
+    val sub = m.subview(range(1, 5, 2), range(1, 6, 2));
+    EXPECT_EQ(sub.extent(0), 2);
+    EXPECT_EQ(sub.extent(1), 3);
+    EXPECT_EQ(sub(0, 0), 7);
+    EXPECT_EQ(sub(1, 2), 23);
+
+    int sum = 0;
+    sub.foreach([&](int x) { sum += x; });
+    EXPECT_EQ(sum, 7 + 9 + 11 + 19 + 21 + 23);
+
+    // a strided view is also constructed explicitly
+    val t = BasicMdView<int, Strided, dynamic_extent, dynamic_extent>(buf.data(), {6, 5}, {1, 6}); // transposed
+    EXPECT_EQ(t(4, 2), m(2, 4));
+
+    BasicMdView<const int, Strided, 5, 6> ms = m;
+    EXPECT_EQ(ms(3, 3), 21);
+}
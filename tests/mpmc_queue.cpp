@@ -0,0 +1,77 @@
+#include "etl/mpmc_queue.h"
+#include "etl/string.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+#include <thread>
+#include <vector>
+
+using namespace Project::etl;
+
+TEST(MpmcQueue, PushPop) {
+    var q = MpmcQueue<String<8>, 4>();
+    EXPECT_EQ(q.size(), 4);
+
+    EXPECT_EQ(q.try_push(String<8>("a")), 1);
+    EXPECT_EQ(q.try_push(String<8>("b")), 1);
+    EXPECT_EQ(q.try_emplace("c"), 1);
+    EXPECT_EQ(q.try_emplace("d"), 1);
+    EXPECT_EQ(q.try_emplace("e"), 0); // full
+    EXPECT_EQ(q.len(), 4);
+
+    String<8> item;
+    EXPECT_EQ(q.try_pop(item), 1);
+    EXPECT_EQ(item, "a");
+    q.push(String<8>("e")); // there is a free slot, does not block
+
+    String<8> items[8];
+    EXPECT_EQ(q.try_pop_n(items, 8), 4);
+    EXPECT_EQ(items[0], "b");
+    EXPECT_EQ(items[3], "e");
+    EXPECT_EQ(q.try_pop(item), 0);
+    EXPECT_EQ(q.try_pop_n(items, 8), 0);
+
+    q.push(String<8>("f")); // remaining items are destroyed by the destructor
+}
+
+static void contention(int nThreads) {
+    static MpmcQueue<uint32_t, 256> q;
+    constexpr uint32_t perProducer = 20'000;
+
+    std::atomic<uint64_t> sum {0};
+    std::atomic<uint32_t> count {0};
+    const uint32_t total = perProducer * nThreads;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < nThreads; ++p) {
+        threads.emplace_back([p] {
+            for (uint32_t i = 0; i < perProducer; ++i) q.push(p * perProducer + i);
+        });
+    }
+    for (int c = 0; c < nThreads; ++c) {
+        threads.emplace_back([&, c] {
+            uint32_t batch[16];
+            while (count.load() < total) {
+                size_t n = 0;
+                if (c % 2) {
+                    n = q.try_pop_n(batch, 16);
+                } else {
+                    n = q.try_pop(batch[0]);
+                }
+                if (n == 0) { std::this_thread::yield(); continue; }
+                uint64_t s = 0;
+                for (size_t i = 0; i < n; ++i) s += batch[i];
+                sum += s;
+                count += uint32_t(n);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(count.load(), total) << nThreads << " threads";
+    EXPECT_EQ(sum.load(), uint64_t(total) * (total - 1) / 2) << nThreads << " threads";
+    EXPECT_EQ(q.len(), 0);
+}
+
+TEST(MpmcQueue, Contention) {
+    for (int n : {1, 2, 4, 8, 16}) contention(n);
+}
@@ -0,0 +1,119 @@
+#include "etl/priority_queue.h"
+#include "etl/static_vector.h"
+#include "etl/string.h"
+#include <queue>
+#include <random>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(PriorityQueue, PushPop) {
+    var a = PriorityQueue<int>{ 3, 1, 4, 1, 5, 9, 2, 6 };
+    EXPECT_EQ(a.len(), 8);
+    EXPECT_EQ(a.top(), 9);
+
+    a << 7;
+    var res = Vector<int>();
+    for (int x; a.pop(x);) res += x;
+    EXPECT_EQ(res, vector(9, 7, 6, 5, 4, 3, 2, 1, 1));
+    EXPECT_FALSE(a);
+    EXPECT_FALSE(a.pop());
+
+    // min-heap of strings on a fixed-capacity container
+    var b = PriorityQueue<String<8>, Greater, StaticVector<String<8>, 4>, 4>();
+    EXPECT_TRUE(b.emplace("d"));
+    EXPECT_TRUE(b.emplace("b"));
+    EXPECT_TRUE(b.emplace("c"));
+    EXPECT_TRUE(b.emplace("a"));
+    EXPECT_FALSE(b.emplace("e")); // full
+    EXPECT_EQ(b.top(), "a");
+    b.pop();
+    EXPECT_EQ(b.top(), "b");
+}
+
+TEST(PriorityQueue, Heapify) {
+    var items = vectorize(range(1000));
+    var a = PriorityQueue<int, Greater, Vector<int>, 4>(etl::move(items));
+    EXPECT_EQ(a.len(), 1000);
+    EXPECT_EQ(a.top(), 0);
+
+    var more = vectorize(range(-500, 0));
+    EXPECT_EQ(a.heapify(more), 500);
+    EXPECT_EQ(a.len(), 1500);
+
+    int prev = -501;
+    for (int x; a.pop(x); prev = x) EXPECT_LE(prev, x);
+    EXPECT_EQ(prev, 999);
+}
+
+template <typename Q>
+static Vector<uint32_t> top_k_workload(Q& q, size_t n) {
+    std::mt19937 rng(42);
+    var res = Vector<uint32_t>();
+    for (size_t i = 0; i < n; ++i) {
+        q.push(uint32_t(rng()));
+        if (i % 4 == 3) {
+            res += q.top();
+            q.pop();
+        }
+    }
+    return res;
+}
+
+TEST(PriorityQueue, AgainstStd) {
+    constexpr size_t n = 1000000;
+    var s = std::priority_queue<uint32_t>();
+    var expected = top_k_workload(s, n);
+
+    var binary = PriorityQueue<uint32_t>();
+    EXPECT_EQ(top_k_workload(binary, n), expected);
+
+    var quaternary = PriorityQueue<uint32_t, Less, Vector<uint32_t>, 4>();
+    EXPECT_EQ(top_k_workload(quaternary, n), expected);
+    EXPECT_EQ(quaternary.len(), s.size());
+}
+
+TEST(PriorityQueue, Indexed) {
+    // dijkstra-like usage, lower distance first
+    var q = IndexedPriorityQueue<int, Greater, 4>();
+    var handles = Vector<size_t>();
+    for (int d : { 50, 40, 30, 20, 10 }) handles += q.push(d);
+    EXPECT_EQ(q.top(), 10);
+    EXPECT_EQ(q.top_handle(), handles[4]);
+
+    EXPECT_TRUE(q.decrease_key(handles[0], 5));
+    EXPECT_EQ(q.top(), 5);
+    EXPECT_EQ(q.top_handle(), handles[0]);
+    EXPECT_FALSE(q.decrease_key(handles[1], 45)); // lower priority
+
+    EXPECT_TRUE(q.update(handles[0], 60));
+    EXPECT_EQ(q.top(), 10);
+    EXPECT_EQ(q.get(handles[0]), 60);
+
+    EXPECT_TRUE(q.remove(handles[4]));
+    EXPECT_FALSE(q.contains(handles[4]));
+    EXPECT_FALSE(q.remove(handles[4]));
+    EXPECT_EQ(q.top(), 20);
+
+    val h = q.push(1); // reuses the removed handle
+    EXPECT_EQ(h, handles[4]);
+    EXPECT_EQ(q.top_handle(), h);
+
+    var res = Vector<int>();
+    for (int x; q.pop(x);) res += x;
+    EXPECT_EQ(res, vector(1, 20, 30, 40, 60));
+}
+
+TEST(PriorityQueue, IndexedRandom) {
+    std::mt19937 rng(7);
+    var q = IndexedPriorityQueue<uint32_t>();
+    var handles = Vector<size_t>();
+    for (int i in range(10000)) {
+        handles += q.push(uint32_t(rng() % 100000));
+        if (i % 3 == 0) q.update(handles[int(rng() % handles.len())], uint32_t(rng() % 100000));
+    }
+
+    uint32_t prev = -1u;
+    for (uint32_t x; q.pop(x); prev = x) EXPECT_GE(prev, x);
+}
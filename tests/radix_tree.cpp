@@ -0,0 +1,116 @@
+#include "etl/radix_tree.h"
+#include "etl/vector.h"
+#include <map>
+#include <random>
+#include <string>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(RadixTree, Basic) {
+    var t = radix_tree<int>({{"topic/a", 1}, {"topic", 2}, {"topic/b", 3}, {"top", 4}});
+    EXPECT_EQ(t.len(), 4);
+    EXPECT_TRUE(t.has("topic"));
+    EXPECT_FALSE(t.has("topi"));
+    EXPECT_FALSE(t.has("topic/"));
+    EXPECT_EQ(t.get("topic/b"), 3);
+    EXPECT_EQ(t.find("t"), nullptr);
+
+    EXPECT_FALSE(t.insert("top", 10)); // already exists
+    EXPECT_TRUE(t.insert("", 0));
+    t["other"] = 5;
+    EXPECT_EQ(t["other"], 5);
+
+    val& c = t;
+    EXPECT_EQ(c["other"], 5);
+    EXPECT_EQ(t.len(), 6);
+
+    var keys = Vector<std::string>();
+    for (val [k, v] : t) keys += std::string(k.data(), k.len());
+    EXPECT_EQ(keys, vector<std::string>("", "other", "top", "topic", "topic/a", "topic/b"));
+    EXPECT_EQ(t.iter().len(), 6);
+
+    EXPECT_TRUE(t.remove("topic"));
+    EXPECT_FALSE(t.remove("topic"));
+    EXPECT_FALSE(t.remove("topic/c"));
+    EXPECT_EQ(t.get("topic/a"), 1);
+    EXPECT_EQ(t.len(), 5);
+
+    t.clear();
+    EXPECT_FALSE(t);
+    EXPECT_EQ(t.begin(), t.end());
+}
+
+TEST(RadixTree, Prefix) {
+    var t = RadixTree<int>();
+    t.insert("/", 0);
+    t.insert("/api", 1);
+    t.insert("/api/v1", 2);
+    t.insert("/api/v1/users", 3);
+    t.insert("/static", 4);
+
+    EXPECT_EQ(t.longest_prefix("/api/v1/users/42").value(), 3);
+    EXPECT_EQ(t.longest_prefix("/api/v2").value(), 1);
+    EXPECT_EQ(t.longest_prefix("/api").key(), "/api");
+    EXPECT_EQ(t.longest_prefix("/index.html").value(), 0);
+    EXPECT_EQ(t.longest_prefix("api"), t.end());
+
+    var values = Vector<int>();
+    for (val [k, v] : t.prefix("/api")) values += v;
+    EXPECT_EQ(values, vector(1, 2, 3));
+    EXPECT_EQ(t.prefix("/api/").len(), 2);
+    EXPECT_EQ(t.prefix("/s").len(), 1);
+    EXPECT_EQ(t.prefix("/x").len(), 0);
+    EXPECT_EQ(t.prefix("").len(), 5);
+}
+
+TEST(RadixTree, AgainstStd) {
+    // long shared prefixes, keys that are prefixes of other keys, and wide fan-out
+    std::mt19937 rng(5);
+    var keys = Vector<std::string>();
+    for (int k = 0; k < 20000; ++k) {
+        std::string key = rng() % 2 ? "sensor/building/floor/" : "";
+        const int n = rng() % 6;
+        for (int j = 0; j < n; ++j) key += char(rng() % 3 ? 'a' + rng() % 4 : rng() % 256);
+        keys += key;
+    }
+
+    var t = RadixTree<int>();
+    var s = std::map<std::string, int>();
+    for (int i in range(60000)) {
+        val& key = keys[int(rng() % keys.len())];
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(t.remove(StringView(key.data(), key.size())), s.erase(key) > 0);
+        } else {
+            EXPECT_EQ(t.insert(StringView(key.data(), key.size()), i), s.emplace(key, i).second);
+        }
+    }
+    ASSERT_EQ(t.len(), s.size());
+
+    var it = s.begin();
+    for (val [k, v] : t) {
+        ASSERT_EQ(std::string(k.data(), k.len()), it->first);
+        EXPECT_EQ(v, it->second);
+        ++it;
+    }
+    EXPECT_EQ(it, s.end());
+
+    for (val& key : keys) {
+        val p = StringView(key.data(), key.size());
+        var found = t.longest_prefix(p);
+        std::string expected;
+        bool any = false;
+        for (size_t n = 0; n <= key.size(); ++n) {
+            if (s.count(key.substr(0, n))) { expected = key.substr(0, n); any = true; }
+        }
+        ASSERT_EQ(found != t.end(), any);
+        if (any) {
+            EXPECT_EQ(std::string(found.key().data(), found.key().len()), expected);
+        }
+    }
+
+    for (val& [k, v] : s) EXPECT_TRUE(t.remove(StringView(k.data(), k.size())));
+    EXPECT_FALSE(t);
+    EXPECT_EQ(t.begin(), t.end());
+}
@@ -7,6 +7,18 @@
 using namespace etl;
 using namespace etl::placeholder;
 
+static constexpr Result<int, const char*> half(int x) {
+    if (x % 2 != 0) return Err("odd");
+    return Ok(x / 2);
+}
+
+TEST(Result, Constexpr) {
+    static_assert(half(4).is_ok());
+    static_assert(half(4).unwrap() == 2);
+    static_assert(half(3).is_err());
+    static_assert(half(3).unwrap_or(-1) == -1);
+}
+
 TEST(Result, Example) {
     {
         Result<int, std::string> a = Ok(50);
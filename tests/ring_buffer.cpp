@@ -0,0 +1,96 @@
+#include "etl/ring_buffer.h"
+#include "etl/vector.h"
+#include "etl/string.h"
+#include "etl/span.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(RingBuffer, PushPop) {
+    var a = RingBuffer<int, 4>();
+    EXPECT_EQ(a.size(), 4);
+    for (val i in range(4)) EXPECT_EQ(a.push(i), 1);
+    EXPECT_TRUE(a.is_full());
+    EXPECT_EQ(a.push(4), 0);
+    EXPECT_EQ(a, vectorize(range(4)));
+
+    int item;
+    a >> item;
+    EXPECT_EQ(item, 0);
+    a << 4 << 5; // wraps around, 5 is discarded
+    EXPECT_EQ(a, vectorize(range(1, 5)));
+    EXPECT_EQ(a.front(), 1);
+    EXPECT_EQ(a.back(), 4);
+    EXPECT_EQ(a[-1], 4);
+
+    EXPECT_EQ(a.push_overwrite(5), 0); // the oldest item is dropped
+    EXPECT_EQ(a, vectorize(range(2, 6)));
+
+    a.clear();
+    EXPECT_FALSE(a);
+    EXPECT_EQ(a.pop(), 0);
+}
+
+TEST(RingBuffer, ReadWrite) {
+    var a = RingBuffer<int, 8>();
+    int src[] = {0, 1, 2, 3, 4, 5};
+    int dest[8] = {};
+
+    EXPECT_EQ(a.write(src, 6), 6);
+    EXPECT_EQ(a.read(dest, 4), 4);
+    EXPECT_EQ(a.write(vector(6, 7, 8, 9, 10, 11, 12)), 6); // wraps around, the last item does not fit
+    EXPECT_TRUE(a.is_full());
+
+    val [first, second] = a.peek();
+    EXPECT_EQ(len(first), 4);
+    EXPECT_EQ(len(second), 4);
+    EXPECT_EQ(first[0], 4);
+    EXPECT_EQ(second[0], 8);
+
+    EXPECT_EQ(a.consume(2), 2);
+    EXPECT_EQ(a.read(dest, 8), 6);
+    EXPECT_EQ(Iter(dest, dest + 6), vectorize(range(6, 12)));
+    EXPECT_FALSE(a);
+
+    var b = RingBuffer<String<8>, 2>();
+    String<8> strings[] = {"abc", "def", "ghi"};
+    EXPECT_EQ(b.write(strings, 3), 2);
+    EXPECT_EQ(b.read(strings + 1, 2), 2);
+    EXPECT_EQ(strings[2], "def");
+}
+
+TEST(RingBuffer, Span) {
+    var a = RingBuffer<uint8_t, 4>();
+    uint8_t src[] = {0, 1, 2, 3, 4};
+    uint8_t dest[3] = {};
+
+    EXPECT_EQ(a.write(span(src).first(3)), 3);
+    EXPECT_EQ(a.read(span(dest).first(2)), 2);
+    EXPECT_EQ(a.write(span(src).last(2)), 2); // wraps around
+    EXPECT_EQ(a.read(span(dest)), 3);
+    EXPECT_EQ(vectorize(span(dest)), vector<uint8_t>(2, 3, 4));
+    EXPECT_EQ(a.read(span(dest)), 0);
+
+    var v = vector(0, 0);
+    var b = RingBuffer<int, 4>();
+    b.write(vector(7, 8, 9));
+    EXPECT_EQ(b.read(v), 2);
+    EXPECT_EQ(v, vector(7, 8));
+}
+
+TEST(RingBuffer, Sequence) {
+    var a = RingBuffer<int, 8>();
+    for (val i in range(6)) a << i;
+    a.consume(4);
+    for (val i in range(6, 10)) a << i; // wraps around
+
+    EXPECT_EQ(vectorize(a | transform(lambda (int x) { return x * 2; })), vector(8, 10, 12, 14, 16, 18));
+    EXPECT_EQ(vectorize(a | filter(lambda (int x) { return x % 3 == 0; })), vector(6, 9));
+    EXPECT_EQ(vectorize(a(1, -1)), vector(5, 6, 7, 8));
+    EXPECT_EQ(vectorize(a.reversed()), vector(9, 8, 7, 6, 5, 4));
+
+    int sum = 0;
+    for (var [x, y] in zip(a, range(6))) sum += x * y;
+    EXPECT_EQ(sum, 4 * 0 + 5 * 1 + 6 * 2 + 7 * 3 + 8 * 4 + 9 * 5);
+}
@@ -0,0 +1,185 @@
+#include "etl/roaring_bitmap.h"
+#include <random>
+#include <set>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(RoaringBitmap, Basic) {
+    var b = roaring_bitmap(7, 3, 1u << 20, 0xFFFF'FFFFu);
+    EXPECT_EQ(b.len(), 4);
+    EXPECT_EQ(b.container_len(), 3);
+    EXPECT_TRUE(b.contains(3));
+    EXPECT_TRUE(b.contains(0xFFFF'FFFFu));
+    EXPECT_FALSE(b.contains(4));
+
+    EXPECT_FALSE(b.add(7));
+    EXPECT_TRUE(b.remove(1u << 20));
+    EXPECT_FALSE(b.remove(1u << 20));
+    EXPECT_EQ(b.container_len(), 2);
+
+    var values = Vector<uint32_t>();
+    for (val x : b) values += x;
+    EXPECT_EQ(values, vector<uint32_t>(3, 7, 0xFFFF'FFFFu));
+    EXPECT_EQ(b.iter().len(), 3);
+
+    b.clear();
+    EXPECT_FALSE(b);
+    EXPECT_EQ(b.begin(), b.end());
+}
+
+TEST(RoaringBitmap, Containers) {
+    var b = RoaringBitmap();
+
+    // grows from an array container to a bitmap container and back
+    for (uint32_t x = 0; x < 10000; x += 2) b << x;
+    EXPECT_EQ(b.len(), 5000);
+    EXPECT_EQ(b.serialized_len(), 4 + 5 + 8192);
+    for (uint32_t x = 0; x < 2000; x += 2) b.remove(x);
+    EXPECT_EQ(b.serialized_len(), 4 + 5 + 4000 * 2);
+
+    // long runs are compressed
+    var r = RoaringBitmap();
+    for (uint32_t x = 100; x < 70000; ++x) r << x;
+    for (uint32_t x = 200000; x < 200100; ++x) r << x;
+    EXPECT_EQ(r.len(), 69900 + 100);
+    val copy = r;
+    EXPECT_TRUE(r.optimize());
+    EXPECT_EQ(r.serialized_len(), 4 + 3 * 5 + 3 * 4);
+    EXPECT_EQ(r, copy);
+    EXPECT_TRUE(r.contains(65535));
+    EXPECT_TRUE(r.contains(65536));
+    EXPECT_FALSE(r.contains(70000));
+    EXPECT_EQ(r.iter().len(), 70000);
+
+    // run containers still accept changes
+    EXPECT_TRUE(r.remove(300));
+    EXPECT_TRUE(r.add(99));
+    EXPECT_FALSE(r.contains(300));
+    EXPECT_TRUE(r.contains(99));
+    EXPECT_EQ(r.len(), 70000);
+}
+
+TEST(RoaringBitmap, Intersect) {
+    std::mt19937 rng(3);
+    for (int t in range(200)) {
+        const size_t na = rng() % 300, nb = t % 10 == 0 ? rng() % 30000 : rng() % 300;
+        var a = std::set<uint16_t>(), b = std::set<uint16_t>();
+        while (a.size() < na) a.insert(uint16_t(rng() % 1000));
+        while (b.size() < nb) b.insert(uint16_t(rng() % (nb > 1000 ? 65536 : 1000)));
+
+        var va = Vector<uint16_t>(), vb = Vector<uint16_t>();
+        for (val x : a) va += x;
+        for (val x : b) vb += x;
+
+        var expected = Vector<uint16_t>();
+        for (val x : a) if (b.count(x)) expected += x;
+
+        var out = Vector<uint16_t>(etl::min(na, nb) + 1, true);
+        out.resize(detail::roaring_intersect(va.data(), va.len(), vb.data(), vb.len(), out.data()));
+        ASSERT_EQ(out, expected);
+    }
+}
+
+static RoaringBitmap<> from_set(const std::set<uint32_t>& s) {
+    var res = RoaringBitmap();
+    for (val x : s) res << x;
+    return res;
+}
+
+static void expect_same(const RoaringBitmap<>& b, const std::set<uint32_t>& s) {
+    ASSERT_EQ(b.len(), s.size());
+    var it = s.begin();
+    for (val x : b) ASSERT_EQ(x, *it++);
+}
+
+TEST(RoaringBitmap, SetOperations) {
+    std::mt19937 rng(7);
+    val make = [&](uint32_t dense) {
+        var s = std::set<uint32_t>();
+        for (int i = 0; i < 20000; ++i) {
+            const uint32_t chunk = rng() % 4;
+            s.insert(chunk << 16 | (chunk < dense ? rng() % 8192 : rng() % 65536));
+        }
+        for (uint32_t x = 5 << 16; x < (5 << 16) + 5000; ++x) s.insert(x); // a run
+        return s;
+    };
+
+    for (uint32_t dense = 0; dense < 3; ++dense) {
+        val x = make(dense), y = make(2 - dense);
+        var a = from_set(x), b = from_set(y);
+        if (dense == 1) a.optimize();
+
+        var u = x, n = std::set<uint32_t>(), d = std::set<uint32_t>();
+        u.insert(y.begin(), y.end());
+        for (val v : x) (y.count(v) ? n : d).insert(v);
+
+        expect_same(a | b, u);
+        expect_same(a & b, n);
+        expect_same(a - b, d);
+
+        var c = a;
+        c |= b;
+        c -= b;
+        EXPECT_EQ(c, a - b);
+        c &= a;
+        EXPECT_EQ(c, a - b);
+    }
+}
+
+TEST(RoaringBitmap, Serialize) {
+    var b = RoaringBitmap();
+    for (uint32_t x = 0; x < 100000; x += 3) b << x;
+    for (uint32_t x = 1u << 24; x < (1u << 24) + 1000; ++x) b << x;
+    b << 0xFFFF'FFFFu;
+    b.optimize();
+
+    val bytes = b.serialize();
+    EXPECT_EQ(bytes.len(), b.serialized_len());
+
+    var c = RoaringBitmap();
+    EXPECT_TRUE(c.deserialize(bytes.data(), bytes.len()));
+    EXPECT_EQ(c, b);
+
+    EXPECT_EQ(b.serialize(nullptr, 10), 0);
+    EXPECT_FALSE(c.deserialize(bytes.data(), bytes.len() - 1));
+    EXPECT_FALSE(c);
+
+    const uint8_t huge[] = {0xFF, 0xFF, 0xFF, 0xFF}; // container count without containers
+    EXPECT_FALSE(c.deserialize(huge, sizeof(huge)));
+
+    var corrupt = bytes;
+    corrupt[6] = 7; // type
+    EXPECT_FALSE(c.deserialize(corrupt.data(), corrupt.len()));
+}
+
+namespace {
+    bool allocation_fails = false;
+
+    template <typename T>
+    struct FailingAllocator {
+        T* allocate(size_t n) { return allocation_fails ? nullptr : Allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) { Allocator<T>().deallocate(p, n); }
+    };
+}
+
+TEST(RoaringBitmap, AllocationFailure) {
+    var b = RoaringBitmap<FailingAllocator<uint32_t>>();
+    for (uint32_t x = 0; x <= 4096; ++x) b << x; // one bitmap container just above the array limit
+
+    allocation_fails = true;
+    EXPECT_FALSE(b.remove(0)); // the conversion to an array fails, the value is kept
+    allocation_fails = false;
+    EXPECT_TRUE(b.contains(0));
+    EXPECT_EQ(len(b), 4097);
+
+    val bytes = b.serialize();
+    var c = RoaringBitmap<FailingAllocator<uint32_t>>();
+    EXPECT_TRUE(c.deserialize(bytes.data(), bytes.len()));
+    EXPECT_EQ(c, b);
+
+    EXPECT_TRUE(b.remove(0));
+    EXPECT_FALSE(b.contains(0));
+    EXPECT_EQ(len(b), 4096);
+}
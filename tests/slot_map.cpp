@@ -0,0 +1,90 @@
+#include "etl/slot_map.h"
+#include "etl/string.h"
+#include <random>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(SlotMap, Basic) {
+    var m = SlotMap<String<8>>();
+    val a = m.insert(String<8>("a"));
+    val b = m.emplace("b%d", 1);
+    val c = m.insert(String<8>("c"));
+    EXPECT_EQ(m.len(), 3);
+    EXPECT_EQ(m[b], "b1");
+    EXPECT_TRUE(m.contains(a));
+    EXPECT_FALSE(m.contains(SlotMap<String<8>>::Handle()));
+
+    // the last item is moved into the place of the removed one, its handle still works
+    EXPECT_TRUE(m.remove(a));
+    EXPECT_FALSE(m.remove(a));
+    EXPECT_FALSE(m.contains(a));
+    EXPECT_EQ(m.find(a), nullptr);
+    EXPECT_EQ(m.get(c), "c");
+    EXPECT_EQ(m.begin()[0], "c");
+    EXPECT_EQ(m.handle_at(0), c);
+
+    // the slot is reused with a new generation, the stale handle doesn't see the new item
+    val d = m.insert(String<8>("d"));
+    EXPECT_EQ(d.index(), a.index());
+    EXPECT_NE(d, a);
+    EXPECT_FALSE(m.contains(a));
+    EXPECT_EQ(m[d], "d");
+
+    String<8> x;
+    EXPECT_TRUE(m.remove(b, x));
+    EXPECT_EQ(x, "b1");
+
+    m.clear();
+    EXPECT_FALSE(m);
+    EXPECT_FALSE(m.contains(c));
+    EXPECT_FALSE(m.contains(d));
+}
+
+TEST(SlotMap, Generation) {
+    using Handle = SlotHandle<uint32_t>;
+    static_assert(sizeof(Handle) == 4);
+    static_assert(sizeof(SlotHandle<>) == 8);
+
+    // a slot is retired once its generation runs out, a stale handle can never become valid again
+    var m = SlotMap<int, Allocator<int>, uint32_t>();
+    val first = m.insert(0);
+    for (int i in range(1 << (Handle::generation_bits - 1))) {
+        val h = m.insert(i);
+        EXPECT_TRUE(m.remove(h));
+        EXPECT_FALSE(m.contains(h));
+    }
+    EXPECT_TRUE(m.contains(first));
+    EXPECT_EQ(m.insert(1).index(), 2);
+}
+
+TEST(SlotMap, Random) {
+    std::mt19937 rng(3);
+    var m = SlotMap<int>();
+    var live = Vector<Pair<SlotMap<int>::Handle, int>>();
+    var dead = Vector<SlotMap<int>::Handle>();
+
+    for (int i in range(100000)) {
+        if (live.len() > 0 && rng() % 2 == 0) {
+            int k = int(rng() % live.len());
+            val [h, v] = live[k];
+            EXPECT_EQ(m.get(h), v);
+            EXPECT_TRUE(m.remove(h));
+            dead += h;
+            live[k] = live.back();
+            live.resize(live.len() - 1);
+        } else {
+            live += Pair<SlotMap<int>::Handle, int>{m.insert(i), i};
+        }
+    }
+
+    EXPECT_EQ(m.len(), live.len());
+    for (val& [h, v] : live) EXPECT_EQ(m.get(h), v);
+    for (val h : dead) EXPECT_FALSE(m.contains(h));
+
+    long sum = 0, expected = 0;
+    for (val v : m) sum += v;
+    for (val& [h, v] : live) expected += v;
+    EXPECT_EQ(sum, expected);
+}
@@ -0,0 +1,100 @@
+#include "etl/small_vector.h"
+#include "etl/string.h"
+#include "etl/json_serialize.h"
+#include "etl/json_deserialize.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(SmallVector, Inline) {
+    var a = small_vector<int, 4>(0, 1, 2);
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(a.size(), 4);
+
+    a += 3;
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(a, vectorize(range(4)));
+
+    a += 4; // spill to the heap
+    EXPECT_FALSE(a.is_inline());
+    EXPECT_EQ(a, vectorize(range(5)));
+
+    a.remove_at(-1);
+    a.shrink(); // back to the inline buffer
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(a, vectorize(range(4)));
+}
+
+TEST(SmallVector, Modify) {
+    var a = small_vector<String<8>, 2>("b", "d");
+    a.insert(0, String<8>("a"));
+    a.insert(2, String<8>("c"));
+    a.emplace_back("e");
+    EXPECT_EQ(len(a), 5);
+    EXPECT_EQ(a[2], "c");
+    EXPECT_EQ(a[-1], "e");
+
+    a.remove("c");
+    EXPECT_EQ(a[2], "d");
+    EXPECT_EQ(vectorize(a(0, 3, 2)), vector<String<8>>("a", "d"));
+    EXPECT_EQ(vectorize(a.reversed())[0], "e");
+}
+
+TEST(SmallVector, CopyMove) {
+    val a = small_vectorize<int, 4>(range(3));
+    var b = a;
+    EXPECT_EQ(a, b);
+
+    val c = etl::move(b); // inline items are relocated
+    EXPECT_EQ(c, a);
+    EXPECT_FALSE(b);
+
+    var d = small_vectorize<int, 4>(range(100));
+    val e = etl::move(d); // heap buffer is stolen
+    EXPECT_EQ(e, vectorize(range(100)));
+    EXPECT_TRUE(d.is_inline());
+    EXPECT_EQ(len(d), 0);
+}
+
+TEST(SmallVector, Concat) {
+    var a = small_vector<int, 4>(0, 3);
+    a.insert(1, small_vector<int, 4>(1, 2));
+    EXPECT_EQ(a, vectorize(range(4)));
+    EXPECT_TRUE(a.is_inline());
+
+    a.insert(-1, a); // spill to the heap
+    EXPECT_EQ(a, vector(0, 1, 2, 0, 1, 2, 3, 3));
+    EXPECT_FALSE(a.is_inline());
+
+    a.append(a); // the items are read by index while the buffer grows
+    EXPECT_EQ(len(a), 16);
+    EXPECT_EQ(a[8], 0);
+
+    val b = small_vector<int, 4>(0, 1) + 2;
+    EXPECT_EQ(b, vectorize(range(3)));
+    EXPECT_EQ(b + b, vector(0, 1, 2, 0, 1, 2));
+    EXPECT_EQ((b + small_vector<int, 4>(3, 4)), vectorize(range(5)));
+
+    // items that are not trivially relocatable are moved one by one
+    var c = SmallVector<Vector<int>, 2>();
+    c += vector(0);
+    c += vector(3);
+    c.insert(1, SmallVector<Vector<int>, 2>{ vector(1), vector(2) });
+    EXPECT_EQ(len(c), 4);
+    EXPECT_EQ(c[2], vector(2));
+    EXPECT_EQ(c[3], vector(3));
+
+    c.remove_at(0);
+    val d = c + vector(4);
+    EXPECT_EQ(d[0], vector(1));
+    EXPECT_EQ(d[-1], vector(4));
+    EXPECT_EQ(len(d), 4);
+}
+
+TEST(SmallVector, Json) {
+    val a = json::deserialize<SmallVector<int, 8>>("[1, 2, 3]").unwrap();
+    EXPECT_EQ(a, vectorize(range(1, 4)));
+    EXPECT_TRUE(a.is_inline());
+    EXPECT_EQ(json::serialize(a), "[1,2,3]");
+}
@@ -0,0 +1,149 @@
+#include "etl/span.h"
+#include "etl/string.h"
+#include "etl/vector.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+static int total(Span<const int> s) {
+    int res = 0;
+    for (val x : s) res += x;
+    return res;
+}
+
+TEST(Span, Basic) {
+    var v = vector(1, 2, 3, 4, 5);
+    EXPECT_EQ(total(v), 15);
+
+    var a = array(1, 2, 3);
+    EXPECT_EQ(total(a), 6);
+
+    int c[] = {4, 5};
+    EXPECT_EQ(total(c), 9);
+
+    Span<int> s = v;
+    EXPECT_EQ(s.len(), 5);
+    EXPECT_EQ(s.size_bytes(), 5 * sizeof(int));
+    EXPECT_EQ(s.data(), v.data());
+    EXPECT_EQ(s[-1], 5);
+    EXPECT_EQ(s.front(), 1);
+    EXPECT_EQ(s.back(), 5);
+    EXPECT_EQ(s.iter().len(), 5);
+    EXPECT_EQ(*s.reversed(), 5);
+    s[0] = 10;
+    EXPECT_EQ(v[0], 10);
+
+    val st = span(a);
+    static_assert(decltype(st)::extent == 3);
+    static_assert(sizeof(Span<int, 3>) == sizeof(Span<int>));
+    Span<const int> dyn = st;
+    EXPECT_EQ(dyn.len(), 3);
+    val fixed = Span<int, 2>(v);
+    EXPECT_EQ(fixed.len(), 2);
+
+    EXPECT_FALSE(Span<int>());
+    EXPECT_TRUE(is_span_v<const Span<int>>);
+}
+
+TEST(Span, String) {
+    val sv = StringView("hello world");
+    Span<const char> s = sv;
+    EXPECT_EQ(s.len(), 11);
+    EXPECT_EQ(s.subspan(6).data(), sv.data() + 6);
+
+    var str = String<16>("abc");
+    Span<char> t = str;
+    EXPECT_EQ(t.len(), 3);
+    t[1] = 'x';
+    EXPECT_EQ(str, "axc");
+}
+
+TEST(Span, Subspan) {
+    var v = vector(0, 1, 2, 3, 4, 5, 6, 7);
+    val s = span(v);
+
+    EXPECT_EQ(s.first(3).back(), 2);
+    EXPECT_EQ(s.last(3).front(), 5);
+    EXPECT_EQ(s.first(100).len(), 8);
+    EXPECT_EQ(s.subspan(2, 3).len(), 3);
+    EXPECT_EQ(s.subspan(2, 3)[0], 2);
+    EXPECT_EQ(s.subspan(6, 5).len(), 2);
+    EXPECT_EQ(s.subspan(9).len(), 0);
+
+    val f = s.first<4>();
+    static_assert(decltype(f)::extent == 4);
+    EXPECT_EQ(f[3], 3);
+    EXPECT_EQ(s.last<2>()[0], 6);
+
+    // contiguous slice
+    val slice = s(2, -2);
+    EXPECT_EQ(slice.len(), 4);
+    EXPECT_EQ(slice[0], 2);
+    EXPECT_EQ(s(-3, 100).len(), 3);
+    EXPECT_EQ(s(5, 2).len(), 0);
+
+    // slice with a step
+    var it = s(1, 8, 3);
+    EXPECT_EQ(it(), 1);
+    EXPECT_EQ(it(), 4);
+    EXPECT_EQ(it(), 7);
+    EXPECT_FALSE(it);
+}
+
+TEST(Span, Bytes) {
+    var a = array<uint16_t>(0x0102, 0x0304);
+    val b = as_bytes(span(a));
+    static_assert(decltype(b)::extent == 4);
+    EXPECT_EQ(b.len(), 4);
+
+    var w = as_writable_bytes(Span<uint16_t>(a));
+    for (var& x : w) x = 0;
+    EXPECT_EQ(a[1], 0);
+}
+
+TEST(Span, Algorithm) {
+    var v = vector<char>('a', 'b', 'c', 'd');
+    val s = span(v);
+    EXPECT_EQ(etl::find(s, 'c'), s.data() + 2);
+    EXPECT_EQ(etl::find(s, 'z'), s.end());
+    EXPECT_EQ(etl::find(s, 'a' + 256), s.end()); // out of range of char
+
+    etl::fill(s.subspan(1, 2), 'x');
+    EXPECT_EQ(v, vector<char>('a', 'x', 'x', 'd'));
+
+    var ints = vector(1, 2, 3, 4, 5);
+    etl::fill(span(ints).first(2), 0);
+    EXPECT_EQ(ints, vector(0, 0, 3, 4, 5));
+    etl::fill(ints, 7);
+    EXPECT_EQ(ints, vector(7, 7, 7, 7, 7));
+
+    val src = array(1, 2, 3);
+    var dest = span(ints);
+    EXPECT_EQ(etl::copy(src, dest), dest.data() + 3);
+    EXPECT_EQ(ints, vector(1, 2, 3, 7, 7));
+
+    // overlapping ranges
+    EXPECT_EQ(etl::copy(ints.begin(), ints.begin() + 3, ints.begin() + 2), ints.begin() + 5);
+    EXPECT_EQ(ints, vector(1, 2, 1, 2, 3));
+    EXPECT_EQ(etl::copy(ints.begin(), ints.end(), dest.begin(), dest.begin() + 2), dest.begin() + 2);
+
+    // volatile elements are accessed one by one
+    volatile uint8_t reg[4] = {};
+    etl::fill(reg, reg + 4, 0xAB);
+    EXPECT_EQ(reg[3], 0xAB);
+    EXPECT_EQ(etl::find(reg, reg + 4, 0xAB), reg);
+    volatile int regs[3] = {1, 2, 3};
+    etl::fill(regs, regs + 2, 0);
+    EXPECT_EQ(regs[1], 0);
+    EXPECT_EQ(etl::copy(regs, regs + 3, ints.begin()), ints.begin() + 3);
+    EXPECT_EQ(ints[2], 3);
+
+    // constant evaluation takes the plain loops
+    constexpr auto found = [] {
+        auto text = array('x', 'y', 'z');
+        etl::fill(text, 'q');
+        return etl::find(text, 'q') - text.begin();
+    }();
+    static_assert(found == 0);
+}
@@ -0,0 +1,76 @@
+#include "etl/spsc_queue.h"
+#include "etl/string.h"
+#include "etl/vector.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+#include <thread>
+
+using namespace Project::etl;
+
+TEST(SpscQueue, PushPop) {
+    var q = SpscQueue<String<8>, 4>();
+    EXPECT_EQ(q.size(), 4);
+    EXPECT_EQ(q.front(), nullptr);
+
+    EXPECT_EQ(q.push("a"), 1);
+    EXPECT_EQ(q.emplace("b"), 1);
+    String<8> items[] = {"c", "d", "e"};
+    EXPECT_EQ(q.push_n(items, 3), 2); // full
+    EXPECT_EQ(q.push("e"), 0);
+    EXPECT_EQ(q.len(), 4);
+
+    EXPECT_EQ(*q.front(), "a");
+    String<8> item;
+    EXPECT_EQ(q.pop(item), 1);
+    EXPECT_EQ(item, "a");
+    EXPECT_EQ(q.pop(), 1);
+    EXPECT_EQ(q.pop_n(items, 3), 2);
+    EXPECT_EQ(items[0], "c");
+    EXPECT_EQ(items[1], "d");
+    EXPECT_EQ(q.pop(item), 0);
+}
+
+TEST(SpscQueue, Wrap) {
+    var q = SpscQueue<int, 8>();
+    int src[] = {0, 1, 2, 3, 4, 5};
+    int dest[8] = {};
+    EXPECT_EQ(q.push_n(src, 6), 6);
+    EXPECT_EQ(q.pop_n(dest, 4), 4);
+    EXPECT_EQ(q.push_n(src, 6), 6); // wraps around
+    EXPECT_EQ(q.pop_n(dest, 8), 8);
+    EXPECT_EQ(Iter(dest, dest + 8), vector(4, 5, 0, 1, 2, 3, 4, 5));
+}
+
+TEST(SpscQueue, Threads) {
+    static SpscQueue<uint32_t, 1024> q;
+    constexpr uint32_t n = 1'000'000;
+
+    std::thread producer([] {
+        uint32_t batch[16];
+        for (uint32_t i = 0; i < n;) {
+            size_t pushed;
+            if (i % 3 == 0) {
+                pushed = q.push(i);
+            } else {
+                size_t m = etl::min(n - i, uint32_t(16));
+                for (uint32_t k = 0; k < m; ++k) batch[k] = i + k;
+                pushed = q.push_n(batch, m);
+            }
+            if (pushed == 0) std::this_thread::yield(); // full
+            i += pushed;
+        }
+    });
+
+    uint32_t expected = 0;
+    bool in_order = true;
+    uint32_t batch[32];
+    while (expected < n) {
+        size_t m = q.pop_n(batch, 32);
+        if (m == 0) std::this_thread::yield(); // empty
+        for (size_t k = 0; k < m; ++k) in_order &= batch[k] == expected++;
+    }
+
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(q.len(), 0);
+}
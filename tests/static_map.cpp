@@ -0,0 +1,51 @@
+#include "etl/static_map.h"
+#include "etl/string.h"
+#include "etl/vector.h"
+#include <string>
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+enum class Method { GET, POST, PUT, DELETE };
+
+TEST(StaticMap, Constexpr) {
+    constexpr auto methods = static_map<Method>({
+        {"GET", Method::GET}, {"POST", Method::POST}, {"PUT", Method::PUT}, {"DELETE", Method::DELETE},
+    });
+
+    static_assert(methods.len() == 4);
+    static_assert(methods.get("POST") == Method::POST);
+    static_assert(methods["DELETE"] == Method::DELETE);
+    static_assert(methods.has("GET"));
+    static_assert(!methods.has("get"));
+    static_assert(!methods.has(""));
+    static_assert(methods.find("PATCH") == nullptr);
+
+    // runtime keys
+    val key = String<8>("PUT");
+    EXPECT_EQ(methods.get(StringView(key)), Method::PUT);
+    EXPECT_EQ(methods.find(StringView("PUTS")), nullptr);
+
+    int n = 0;
+    for (val& [k, v] : methods) {
+        EXPECT_EQ(methods.get(k), v);
+        ++n;
+    }
+    EXPECT_EQ(n, 4);
+}
+
+TEST(StaticMap, Many) {
+    constexpr size_t n = 2000;
+    var names = Vector<std::string>();
+    for (size_t i = 0; i < n; ++i) names += "key_" + std::to_string(i * 7);
+
+    static Pair<StringView, int> pairs[n] = {};
+    for (size_t i = 0; i < n; ++i) pairs[i] = {StringView(names[i].data(), names[i].size()), int(i)};
+
+    val m = StaticMap<int, n>(pairs);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(m.get(pairs[i].x), int(i));
+        EXPECT_FALSE(m.has(("key_" + std::to_string(i * 7 + 1)).c_str()));
+    }
+}
@@ -0,0 +1,58 @@
+#include "etl/static_vector.h"
+#include "etl/vector.h"
+#include "etl/string.h"
+#include "etl/json_serialize.h"
+#include "etl/json_deserialize.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+
+using namespace Project::etl;
+
+TEST(StaticVector, Append) {
+    var a = static_vector<int, 4>(0, 1);
+    EXPECT_EQ(a.size(), 4);
+    EXPECT_TRUE(a.append(2));
+    EXPECT_NE(a.emplace_back(3), nullptr);
+    EXPECT_TRUE(a.is_full());
+
+    EXPECT_FALSE(a.append(4)); // full
+    EXPECT_EQ(a.emplace_back(4), nullptr);
+    EXPECT_FALSE(a.insert(0, -1));
+    EXPECT_EQ(a, vectorize(range(4)));
+
+    int arr[] = {5, 6, 7};
+    var b = StaticVector<int, 5>();
+    EXPECT_FALSE(b.append(arr, arr + 3) && b.append(arr, arr + 3));
+    EXPECT_EQ(b, vector(5, 6, 7, 5, 6));
+}
+
+TEST(StaticVector, Modify) {
+    var a = static_vector<String<8>, 8>("b", "d");
+    a.insert(0, String<8>("a"));
+    a.insert(-1, String<8>("c"));
+    a += String<8>("e");
+    EXPECT_EQ(len(a), 5);
+    EXPECT_EQ(a[2], "c");
+    EXPECT_EQ(a[-1], "e");
+
+    EXPECT_TRUE(a.remove("c"));
+    EXPECT_TRUE(a.remove_at(0));
+    EXPECT_EQ(a.front(), "b");
+    EXPECT_EQ(vectorize(a.reversed())[0], "e");
+
+    val b = a; // copy
+    a.clear();
+    EXPECT_FALSE(a);
+    EXPECT_EQ(len(b), 3);
+    EXPECT_EQ(b[1], "d");
+}
+
+TEST(StaticVector, Json) {
+    val a = json::deserialize<StaticVector<int, 4>>("[1, 2, 3]").unwrap();
+    EXPECT_EQ(a, vectorize(range(1, 4)));
+    EXPECT_EQ(json::serialize(a), "[1,2,3]");
+    EXPECT_EQ(json::size_max(a), 7);
+
+    val b = json::deserialize<StaticVector<int, 2>>("[1, 2, 3]");
+    EXPECT_FALSE(b.is_ok());
+}
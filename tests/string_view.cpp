@@ -150,4 +150,13 @@ TEST(StringView, Parse) {
     EXPECT_EQ(split1.to_int(), 168);
     EXPECT_EQ(split2.to_int(), 200);
     EXPECT_EQ(split3.to_int(), 247);
-}
\ No newline at end of file
+}
+TEST(StringView, Ordering) {
+    static_assert("abc"sv < "abd"sv);
+    static_assert("ab"sv < "abc"sv);
+    static_assert(!("abc"sv < "abc"sv));
+    EXPECT_TRUE("b"sv > "abc"sv);
+    EXPECT_TRUE("abc"sv <= "abc"sv);
+    EXPECT_TRUE("abc"sv >= "ab"sv);
+    EXPECT_FALSE(""sv > "a"sv);
+}
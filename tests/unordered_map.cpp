@@ -70,3 +70,77 @@ TEST(unordered_map, Util) {
     EXPECT_EQ(next(names), "Jupri");
 }
 
+TEST(unordered_map, Rehash) {
+    var m = unordered_map<int, int>();
+    for (int i = 0; i < 10000; ++i) m[i] = i * 2;
+    EXPECT_EQ(len(m), 10000);
+    EXPECT_GE(m.size(), 10000);
+
+    for (int i = 0; i < 10000; ++i) EXPECT_EQ(m.get(i), i * 2);
+    EXPECT_FALSE(m.has(10000));
+    EXPECT_FALSE(m.has(-1));
+
+    // insertion order is preserved
+    int i = 0;
+    for (val [k, v] in m) {
+        EXPECT_EQ(k, i);
+        EXPECT_EQ(v, i * 2);
+        ++i;
+    }
+}
+
+TEST(unordered_map, RemoveMany) {
+    var m = unordered_map<int, int>();
+    for (int i = 0; i < 1000; ++i) m[i] = i;
+    for (int i = 0; i < 1000; i += 2) EXPECT_TRUE(m.remove(i));
+    EXPECT_FALSE(m.remove(0));
+    EXPECT_EQ(len(m), 500);
+
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(m.has(i), i % 2 == 1);
+
+    // reuse the deleted slots
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 1000; i += 2) m[i] = round;
+        for (int i = 0; i < 1000; i += 2) EXPECT_TRUE(m.remove(i));
+    }
+    EXPECT_EQ(len(m), 500);
+    for (int i = 1; i < 1000; i += 2) EXPECT_EQ(m.get(i), i);
+}
+
+TEST(unordered_map, CopyMove) {
+    var a = unordered_map<StringView, int>({{"one", 1}, {"two", 2}, {"three", 3}});
+    var b = a;
+    EXPECT_EQ(len(b), 3);
+    EXPECT_EQ(b["two"], 2);
+
+    var c = move(a);
+    EXPECT_EQ(len(a), 0);
+    EXPECT_FALSE(a.has("one"));
+    EXPECT_EQ(len(c), 3);
+    EXPECT_EQ(c["three"], 3);
+
+    c.clear();
+    EXPECT_EQ(len(c), 0);
+    EXPECT_FALSE(c.has("three"));
+    c["three"] = 33;
+    EXPECT_EQ(c.get("three"), 33);
+}
+
+TEST(unordered_map, KeyTypes) {
+    enum class Color { RED, GREEN, BLUE };
+    var colors = UnorderedMap<Color, int>();
+    colors[Color::RED] = 1;
+    colors[Color::BLUE] = 3;
+    EXPECT_EQ(colors.len(), 2);
+    EXPECT_EQ(colors[Color::BLUE], 3);
+    EXPECT_FALSE(colors.has(Color::GREEN));
+
+    var floats = UnorderedMap<float, int>();
+    floats[0.5f] = 1;
+    floats[-0.0f] = 2;
+    EXPECT_EQ(floats[0.0f], 2);
+    EXPECT_EQ(floats[0.5f], 1);
+    EXPECT_EQ(floats.len(), 2);
+
+    EXPECT_EQ(etl::hash(1.5), etl::hash(1.5f));
+}
@@ -60,6 +60,33 @@ TEST(Utility, range) {
     EXPECT_EQ(reversed(r1), range(9, -1, -1));
 }
 
+TEST(Range, Len) {
+    // the last step may end before stop
+    EXPECT_EQ(range(1, 6, 2).len(), 3);
+    EXPECT_EQ(range(1, 7, 2).len(), 3);
+    EXPECT_EQ(range(0, 10, 3).len(), 4);
+    EXPECT_EQ(range(5).len(), 5);
+    EXPECT_EQ(range(1u, 6u, 2).len(), 3);
+
+    EXPECT_EQ(range(10, 0, -3).len(), 4);
+    EXPECT_EQ(range(10, 0, -5).len(), 2);
+    EXPECT_EQ(range(6u, 1u, -2).len(), 3);
+    EXPECT_EQ(range(0.0, 1.0, 0.3).len(), 4);
+
+    EXPECT_EQ(range(0, 10, -1).len(), 0);
+    EXPECT_EQ(range(10, 0, 1).len(), 0);
+    EXPECT_EQ(range(3, 3).len(), 0);
+
+    // len agrees with the number of iterated items
+    for (val step : {1, 2, 3, 7, -1, -2, -3, -7}) {
+        val r = step > 0 ? range(-5, 12, step) : range(12, -5, step);
+        size_t n = 0;
+        for (val i in r) { (void)i; ++n; }
+        EXPECT_EQ(r.len(), n);
+        EXPECT_EQ(r[-1], r[int(n) - 1]);
+    }
+}
+
 TEST(Utility, enumerate) {
     var p = array(10, 11, 12);
     for (var [x, y] in enumerate(p, 10)) {
@@ -0,0 +1,179 @@
+#include "etl/variant.h"
+#include "etl/string.h"
+#include "etl/vector.h"
+#include "etl/memory.h"
+#include "gtest/gtest.h"
+#include "etl/keywords.h"
+#include <string>
+#include <variant>
+
+using namespace Project::etl;
+
+TEST(Variant, Construct) {
+    var a = Variant<int, double, bool, std::string>();
+    EXPECT_EQ(a.index(), 0);
+    EXPECT_EQ(a.get<int>(), 0);
+
+    a = 3.14;
+    EXPECT_TRUE(a.holds<double>());
+    EXPECT_EQ(a.get<1>(), 3.14);
+
+    a = "text"; // const char* should not decay to bool
+    EXPECT_TRUE(a.holds<std::string>());
+    EXPECT_EQ(a.get<std::string>(), "text");
+
+    a = true;
+    EXPECT_TRUE(a.holds<bool>());
+    EXPECT_EQ(a.get_if<int>(), nullptr);
+    EXPECT_NE(a.get_if<bool>(), nullptr);
+
+    a.emplace<std::string>(3, 'x');
+    EXPECT_EQ(a.get<std::string>(), "xxx");
+    EXPECT_THROW(a.get<int>(), std::bad_variant_access);
+
+    var b = a;
+    EXPECT_EQ(b, a);
+
+    var c = etl::move(b);
+    EXPECT_EQ(c.get<std::string>(), "xxx");
+
+    b = 42;
+    EXPECT_NE(b, a);
+    a = b;
+    EXPECT_EQ(a.get<int>(), 42);
+}
+
+TEST(Variant, Lifetime) {
+    static int alive = 0;
+    struct Tracked {
+        Tracked() { ++alive; }
+        Tracked(const Tracked&) { ++alive; }
+        ~Tracked() { --alive; }
+    };
+
+    {
+        var a = Variant<int, Tracked>(Tracked());
+        EXPECT_EQ(alive, 1);
+
+        var b = a;
+        EXPECT_EQ(alive, 2);
+
+        b = 1;
+        EXPECT_EQ(alive, 1);
+
+        b = a;
+        EXPECT_EQ(alive, 2);
+
+        a.emplace<int>(0);
+        EXPECT_EQ(alive, 1);
+    }
+    EXPECT_EQ(alive, 0);
+}
+
+TEST(Variant, Constexpr) {
+    constexpr auto a = Variant<int, double>(2.5);
+    static_assert(a.index() == 1);
+    static_assert(a.holds<double>());
+    static_assert(a.get<double>() == 2.5);
+    static_assert(a.get_if<int>() == nullptr);
+
+    constexpr auto b = Variant<char, int>();
+    static_assert(b.get<char>() == '\0');
+}
+
+TEST(Variant, Exception) {
+    struct Throwing {
+        int value;
+        explicit Throwing(int value) : value(value) {}
+        Throwing(const Throwing& other) : value(other.value) { if (value < 0) throw 1; }
+        Throwing& operator=(const Throwing&) = default;
+        bool operator==(const Throwing& other) const { return value == other.value; }
+    };
+
+    static_assert(is_nothrow_move_constructible_v<Variant<int, std::string>>);
+    static_assert(!is_nothrow_move_constructible_v<Variant<int, Throwing>>);
+
+    var a = Variant<std::string, Throwing>("text");
+    var bad = Variant<std::string, Throwing>(Throwing(1));
+    bad.get<Throwing>().value = -1;
+
+    // the copy is made before the string is destroyed
+    EXPECT_THROW(a = bad, int);
+    EXPECT_EQ(a.get<std::string>(), "text");
+
+    EXPECT_THROW(a = bad.get<Throwing>(), int);
+    EXPECT_EQ(a.get<std::string>(), "text");
+
+    // emplace destroys the string first and the variant is left valueless
+    EXPECT_THROW(a.emplace<Throwing>(bad.get<Throwing>()), int);
+    EXPECT_TRUE(a.valueless_by_exception());
+    EXPECT_THROW(a.get<std::string>(), std::bad_variant_access);
+    EXPECT_THROW(a.visit([](val&) {}), std::bad_variant_access);
+
+    var b = a;
+    EXPECT_TRUE(b.valueless_by_exception());
+    EXPECT_EQ(b, a);
+
+    a = std::string("again");
+    EXPECT_EQ(a.get<std::string>(), "again");
+}
+
+TEST(Variant, Size) {
+    using Small = Variant<char, bool, uint8_t>;
+    static_assert(sizeof(Small) == 2);
+    static_assert(sizeof(Variant<char, int16_t>) == 4);
+    static_assert(sizeof(Small::index_type) == 1);
+    static_assert(is_trivially_copyable_v<Small>);
+    static_assert(is_trivially_destructible_v<Small>);
+    static_assert(!is_trivially_copyable_v<Variant<int, std::string>>);
+    static_assert(is_trivially_relocatable_v<Variant<int, Vector<int>>>);
+
+    static_assert(sizeof(Variant<int, double>) <= sizeof(std::variant<int, double>));
+    static_assert(sizeof(Variant<char, int16_t, String<7>>) <= sizeof(std::variant<char, int16_t, String<7>>));
+}
+
+TEST(Variant, MoveOnly) {
+    using V = Variant<int, unique_ptr<int>>;
+    static_assert(!is_copy_constructible_v<V>);
+    static_assert(!is_copy_assignable_v<V>);
+    static_assert(is_move_constructible_v<V>);
+    static_assert(is_move_assignable_v<V>);
+    static_assert(is_copy_constructible_v<Variant<int, std::string>>);
+
+    var a = V(unique_ptr<int>(new int(4)));
+    var b = etl::move(a);
+    EXPECT_EQ(*b.get<unique_ptr<int>>(), 4);
+
+    a = 1;
+    a = etl::move(b);
+    EXPECT_EQ(*a.get<unique_ptr<int>>(), 4);
+}
+
+TEST(Variant, Visit) {
+    var items = Vector<Variant<int, double, String<8>>>();
+    for (int i : range(300000)) {
+        switch (i % 3) {
+            case 0: items += i; break;
+            case 1: items += double(i); break;
+            default: items += String<8>("a"); break;
+        }
+    }
+
+    // size of each alternative
+    size_t total = 0;
+    for (val& item : items) {
+        total += visit([](val& x) -> size_t { return sizeof(x); }, item);
+    }
+    EXPECT_EQ(total, 100000 * (sizeof(int) + sizeof(double) + sizeof(String<8>)));
+
+    // mutable visit
+    for (var& item : items) {
+        item.visit([](auto& x) {
+            if constexpr (is_arithmetic_v<decay_t<decltype(x)>>) x *= 2;
+            else x += "b";
+        });
+    }
+    EXPECT_EQ(items[3].get<int>(), 6);
+    EXPECT_EQ(items[4].get<double>(), 8.0);
+    EXPECT_EQ(items[5].get<String<8>>(), "ab");
+}
@@ -1,7 +1,9 @@
 #include "etl/vector.h"
 #include "etl/string.h"
+#include "etl/intrusive_list.h"
 #include "gtest/gtest.h"
 #include "etl/keywords.h"
+#include <string>
 
 using namespace Project::etl;
 
@@ -156,3 +158,154 @@ TEST(Vector, Vectorize) {
     EXPECT_FALSE(v);
     EXPECT_EQ(d, vectorize(range(1, 4)));
 }
+
+namespace {
+    size_t allocation_count = 0;
+
+    template <typename T>
+    struct CountingAllocator {
+        T* allocate(size_t n) { ++allocation_count; return Allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) { Allocator<T>().deallocate(p, n); }
+    };
+
+    bool allocation_fails = false;
+
+    template <typename T>
+    struct FailingAllocator {
+        T* allocate(size_t n) { return allocation_fails ? nullptr : Allocator<T>().allocate(n); }
+        void deallocate(T* p, size_t n) { Allocator<T>().deallocate(p, n); }
+        T* reallocate(T* p, size_t m, size_t n) { return allocation_fails ? nullptr : Allocator<T>().reallocate(p, m, n); }
+    };
+}
+
+TEST(Vector, ReserveFailure) {
+    var a = Vector<int, FailingAllocator<int>>();
+    a.append(range(10).begin(), range(10).end());
+
+    allocation_fails = true;
+    EXPECT_FALSE(a.reserve(5)); // the truncated items are kept
+    EXPECT_FALSE(a.reserve(100));
+    allocation_fails = false;
+    EXPECT_EQ(a, vectorize(range(10)));
+
+    EXPECT_TRUE(a.reserve(5));
+    EXPECT_EQ(a, vectorize(range(5)));
+    EXPECT_TRUE(a.reserve(100));
+    EXPECT_EQ(a.size(), 100);
+    EXPECT_EQ(a, vectorize(range(5)));
+}
+
+TEST(Vector, Growth) {
+    allocation_count = 0;
+    var a = Vector<int, CountingAllocator<int>>();
+    for (int i = 0; i < 10'000'000; ++i) a.append(i);
+
+    EXPECT_EQ(a.len(), 10'000'000);
+    EXPECT_EQ(a.back(), 9'999'999);
+    EXPECT_GE(a.size(), a.len());
+    EXPECT_LT(allocation_count, 64); // logarithmic number of reallocations
+}
+
+TEST(Vector, EmplaceBack) {
+    struct Point { 
+        int x, y; 
+        Point(int x, int y) : x(x), y(y) {}
+    };
+
+    var a = vector<Point>();
+    val p = a.emplace_back(1, 2);
+    EXPECT_EQ(p, &a[0]);
+    a.emplace_back(3, 4);
+    EXPECT_EQ(a.len(), 2);
+    EXPECT_EQ(a[1].x, 3);
+    EXPECT_EQ(a[1].y, 4);
+
+    var b = vector<String<8>>();
+    b.emplace_back("abc");
+    EXPECT_EQ(b[0], "abc");
+}
+
+TEST(Vector, AppendRange) {
+    int arr[] = {2, 3, 4};
+    var a = vector(0, 1);
+    a.append(arr, arr + 3);
+    EXPECT_EQ(a, vectorize(range(5)));
+    EXPECT_EQ(a.size(), 5); // reserved once
+
+    val b = vector(5, 6, 7);
+    a.append(b.begin(), b.end());
+    EXPECT_EQ(a, vectorize(range(8)));
+
+    // ranges of the same vector stay valid while the buffer grows
+    var c = vector<std::string>("a", "b", "c");
+    c.shrink();
+    c.append(c.begin() + 1, c.end());
+    EXPECT_EQ(c, vector<std::string>("a", "b", "c", "b", "c"));
+
+    c.shrink();
+    c.append(c);
+    EXPECT_EQ(len(c), 10);
+    EXPECT_EQ(c[5], "a");
+
+    c.shrink();
+    c.insert(1, c);
+    EXPECT_EQ(len(c), 20);
+    EXPECT_EQ(c[1], "a");
+    EXPECT_EQ(c[11], "b");
+}
+
+namespace {
+    int move_count = 0;
+
+    struct Tracked {
+        int value;
+        explicit Tracked(int value) : value(value) {}
+        Tracked(const Tracked& other) : value(other.value) {}
+        Tracked(Tracked&& other) noexcept : value(other.value) { ++move_count; }
+        Tracked& operator=(const Tracked& other) { value = other.value; return *this; }
+        Tracked& operator=(Tracked&& other) noexcept { value = other.value; ++move_count; return *this; }
+        bool operator==(const Tracked& other) const { return value == other.value; }
+    };
+}
+
+template <> struct Project::etl::is_trivially_relocatable<Tracked> : true_type {};
+
+TEST(Vector, Relocate) {
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<Pair<int, float>>);
+    static_assert(is_trivially_relocatable_v<StringView>);
+    static_assert(is_trivially_relocatable_v<Pair<StringView, Vector<int>>>);
+    static_assert(!is_trivially_relocatable_v<Pair<int, IntrusiveListHook>>);
+
+    move_count = 0;
+    var a = vector<Tracked>();
+    for (int i = 0; i < 100; ++i) a.emplace_back(i);
+    a.insert(0, Tracked(-1));
+    a.remove_at(0);
+    a.remove_at(50);
+    a.reserve(1000);
+    EXPECT_EQ(move_count, 1); // only the explicit temporary is moved into place
+    EXPECT_EQ(a.len(), 99);
+    EXPECT_EQ(a[49].value, 49);
+    EXPECT_EQ(a[50].value, 51);
+
+    var b = vector(vector(1, 2), vector(5, 6));
+    b.insert(1, vector(vector(3), vector(4)));
+    b.insert(0, vector(0));
+    b.remove_at(-1);
+    EXPECT_EQ(b.len(), 4);
+    EXPECT_EQ(b[0], vector(0));
+    EXPECT_EQ(b[2], vector(3));
+    EXPECT_EQ(b[3], vector(4));
+    b.shrink();
+    EXPECT_EQ(b.size(), 4);
+    EXPECT_EQ(b[1], vector(1, 2));
+
+    // large POD vector, every insertion at the front is a single memmove
+    var c = vectorize(range(100'000));
+    for (int i = 0; i < 1000; ++i) c.insert(0, -1);
+    EXPECT_EQ(c.len(), 101'000);
+    EXPECT_EQ(c[999], -1);
+    EXPECT_EQ(c[1000], 0);
+    EXPECT_EQ(c.back(), 99'999);
+}